@@ -24,6 +24,32 @@ namespace PCGExData
 	{
 	}
 
+	FPointColumns::FPointColumns(const UPCGPointData* InData)
+	{
+		const TArray<FPCGPoint>& Points = InData->GetPoints();
+		const int32 NumPoints = Points.Num();
+
+		PCGEX_SET_NUM_UNINITIALIZED(Positions, NumPoints)
+		PCGEX_SET_NUM_UNINITIALIZED(Rotations, NumPoints)
+		PCGEX_SET_NUM_UNINITIALIZED(Scales, NumPoints)
+		PCGEX_SET_NUM_UNINITIALIZED(BoundsMin, NumPoints)
+		PCGEX_SET_NUM_UNINITIALIZED(BoundsMax, NumPoints)
+		PCGEX_SET_NUM_UNINITIALIZED(Density, NumPoints)
+		PCGEX_SET_NUM_UNINITIALIZED(Seed, NumPoints)
+
+		for (int i = 0; i < NumPoints; ++i)
+		{
+			const FPCGPoint& Point = Points[i];
+			Positions[i] = Point.Transform.GetLocation();
+			Rotations[i] = Point.Transform.GetRotation();
+			Scales[i] = Point.Transform.GetScale3D();
+			BoundsMin[i] = Point.BoundsMin;
+			BoundsMax[i] = Point.BoundsMax;
+			Density[i] = Point.Density;
+			Seed[i] = Point.Seed;
+		}
+	}
+
 	FCacheBase* FFacade::FindCacheUnsafe(const uint64 UID)
 	{
 		FCacheBase** Found = CacheMap.Find(UID);
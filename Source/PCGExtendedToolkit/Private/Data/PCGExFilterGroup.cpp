@@ -3,6 +3,8 @@
 
 #include "Data/PCGExFilterGroup.h"
 
+#include "PCGModule.h"
+#include "Algo/StableSort.h"
 #include "Graph/PCGExCluster.h"
 
 namespace PCGExFilterGroup
@@ -34,6 +36,34 @@ namespace PCGExFilterGroup
 		*/
 	}
 
+	bool TFilterGroup::IsConstant(bool& OutResult) const
+	{
+		// Neutral element is true for AND, false for OR; absorbing element is the opposite.
+		const bool bNeutral = GetMode() == EPCGExFilterGroupMode::AND;
+
+		bool bAllConstant = true;
+		for (const PCGExPointFilter::TFilter* Filter : ManagedFilters)
+		{
+			bool bFilterResult = false;
+			if (!Filter->IsConstant(bFilterResult))
+			{
+				bAllConstant = false;
+				continue;
+			}
+
+			if (bFilterResult != bNeutral)
+			{
+				OutResult = bInvert ? bNeutral : !bNeutral;
+				return true;
+			}
+		}
+
+		if (!bAllConstant) { return false; }
+
+		OutResult = bInvert ? !bNeutral : bNeutral;
+		return true;
+	}
+
 	bool TFilterGroup::InitManaged(const FPCGContext* InContext)
 	{
 		for (const UPCGExFilterFactoryBase* ManagedFactory : *ManagedFactories)
@@ -99,6 +129,8 @@ namespace PCGExFilterGroup
 			PostInitManagedFilter(InContext, Filter);
 		}
 
+		if (GroupFactory->bReorderBySelectivity) { ReorderBySelectivity(InContext); }
+
 		return true;
 	}
 
@@ -106,6 +138,88 @@ namespace PCGExFilterGroup
 	{
 		InFilter->PostInit();
 	}
+
+	void TFilterGroup::ReorderBySelectivity(const FPCGContext* InContext)
+	{
+		if (ManagedFilters.Num() < 2) { return; }
+
+		const PCGExCluster::FNode* Nodes = bInitForCluster && Cluster ? Cluster->Nodes->GetData() : nullptr;
+		const int32 NumItems = Nodes ? Cluster->Nodes->Num() : PointDataFacade->Source->GetNum();
+		const int32 NumSamples = FMath::Min(NumItems, FMath::Max(1, GroupFactory->SelectivitySampleSize));
+
+		if (NumSamples <= 0) { return; }
+
+		// Scoped readers only hold values for fetched scopes, so sample a contiguous head of points in that case
+		const bool bContiguous = PointDataFacade->bSupportsScopedGet;
+		if (bContiguous) { PointDataFacade->Fetch(0, NumSamples); }
+		const int32 Stride = bContiguous ? 1 : NumItems / NumSamples;
+
+		// Node point indices are arbitrary, only keep nodes whose point was fetched
+		TArray<const PCGExCluster::FNode*> SampleNodes;
+		if (Nodes)
+		{
+			SampleNodes.Reserve(NumSamples);
+			for (int i = 0; i < NumItems && SampleNodes.Num() < NumSamples; i += Stride)
+			{
+				if (!bContiguous || Nodes[i].PointIndex < NumSamples) { SampleNodes.Add(Nodes + i); }
+			}
+
+			if (SampleNodes.IsEmpty()) { return; }
+		}
+
+		const int32 NumTests = Nodes ? SampleNodes.Num() : NumSamples;
+
+		struct FFilterStats
+		{
+			PCGExPointFilter::TFilter* Filter = nullptr;
+			double Cost = 0;
+			double PassRate = 0;
+			double Rank = 0;
+		};
+
+		const bool bIsAND = GetMode() == EPCGExFilterGroupMode::AND;
+
+		TArray<FFilterStats> Stats;
+		Stats.Reserve(ManagedFilters.Num());
+
+		for (PCGExPointFilter::TFilter* Filter : ManagedFilters)
+		{
+			int32 NumPass = 0;
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+
+			if (Nodes) { for (const PCGExCluster::FNode* Node : SampleNodes) { NumPass += Filter->Test(*Node); } }
+			else { for (int i = 0; i < NumSamples; ++i) { NumPass += Filter->Test(i * Stride); } }
+
+			FFilterStats& FilterStats = Stats.Emplace_GetRef();
+			FilterStats.Filter = Filter;
+			FilterStats.Cost = static_cast<double>(FMath::Max<uint64>(1, FPlatformTime::Cycles64() - StartCycles)) / NumTests;
+			FilterStats.PassRate = static_cast<double>(NumPass) / NumTests;
+
+			// AND groups exit on the first fail, OR groups on the first pass.
+			// Ranking by cost over decisiveness minimizes the expected cost per point for independent filters.
+			const double Decisiveness = bIsAND ? 1 - FilterStats.PassRate : FilterStats.PassRate;
+			FilterStats.Rank = FilterStats.Cost / FMath::Max(Decisiveness, UE_SMALL_NUMBER);
+		}
+
+		Algo::StableSortBy(Stats, &FFilterStats::Rank);
+
+		for (int i = 0; i < Stats.Num(); ++i)
+		{
+			ManagedFilters[i] = Stats[i].Filter;
+			Stats[i].Filter->FilterIndex = i;
+		}
+
+		if (!UE_LOG_ACTIVE(LogPCG, Verbose)) { return; }
+
+		FString Report = FString::Printf(TEXT("%s group order (%d samples):"), bIsAND ? TEXT("AND") : TEXT("OR"), NumTests);
+		for (int i = 0; i < Stats.Num(); ++i)
+		{
+			const FFilterStats& FilterStats = Stats[i];
+			Report += FString::Printf(TEXT(" [%d] %s (pass %.0f%%, %.1f cycles)"), i, *FilterStats.Filter->Factory->GetName(), FilterStats.PassRate * 100, FilterStats.Cost);
+		}
+
+		PCGE_LOG_C(Verbose, LogOnly, InContext, FText::FromString(Report));
+	}
 }
 
 PCGExPointFilter::TFilter* UPCGExFilterGroupFactoryBaseAND::CreateFilter() const
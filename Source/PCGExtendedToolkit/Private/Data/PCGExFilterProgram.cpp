@@ -0,0 +1,289 @@
+﻿// Copyright Timothé Lapetite 2024
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Data/PCGExFilterProgram.h"
+
+#include "Data/PCGExFilterGroup.h"
+#include "Graph/PCGExCluster.h"
+
+namespace PCGExPointFilter
+{
+	void FFilterProgram::Compile(const TArray<TFilter*>& InFilters)
+	{
+		Instructions.Empty();
+		Operands.Empty();
+		CompiledFactories.Empty();
+		ConstRegisters[0] = ConstRegisters[1] = -1;
+
+		TArray<int32> Registers;
+		Registers.Reserve(InFilters.Num());
+		for (const TFilter* Filter : InFilters) { Registers.Add(CompileFilter(Filter)); }
+
+		Root = CompileCombine(EFilterOp::And, Registers);
+
+		CompiledFactories.Empty();
+
+		// Count reads from the instructions actually reachable from the root
+		TArray<bool> Visited;
+		Visited.SetNumZeroed(Instructions.Num());
+
+		TArray<int32> Stack;
+		Stack.Add(Root);
+
+		while (!Stack.IsEmpty())
+		{
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION <= 3
+			const int32 Register = Stack.Pop(false);
+#else
+			const int32 Register = Stack.Pop(EAllowShrinking::No);
+#endif
+			if (Visited[Register]) { continue; }
+			Visited[Register] = true;
+
+			const FFilterInstruction& Instruction = Instructions[Register];
+			for (int o = 0; o < Instruction.NumOperands; ++o)
+			{
+				const int32 Operand = Operands[Instruction.FirstOperand + o];
+				Instructions[Operand].NumUses++;
+				Stack.Add(Operand);
+			}
+		}
+	}
+
+	bool FFilterProgram::IsConstant(bool& OutValue) const { return GetConst(Root, OutValue); }
+
+	struct FFilterProgram::FScope
+	{
+		int32 StartIndex = 0;
+		int32 Count = 0;
+		int32 NumWords = 0;
+		const PCGExCluster::FNode* Nodes = nullptr;
+		uint64* Registers = nullptr;
+		uint64* LiveMasks = nullptr;
+		const uint64* FullMask = nullptr;
+		bool* Evaluated = nullptr;
+	};
+
+	void FFilterProgram::Evaluate(const int32 StartIndex, const int32 Count, uint64* OutBits, const PCGExCluster::FNode* InNodes) const
+	{
+		const int32 NumWords = GetNumWords(Count);
+		if (!NumWords) { return; }
+
+		const int32 NumInstructions = Instructions.Num();
+
+		TArray<uint64, TInlineAllocator<128>> Registers;
+		PCGEX_SET_NUM_UNINITIALIZED(Registers, NumInstructions * NumWords)
+
+		// One live mask per combine instruction, plus the full scope mask
+		TArray<uint64, TInlineAllocator<128>> LiveMasks;
+		PCGEX_SET_NUM_UNINITIALIZED(LiveMasks, (NumInstructions + 1) * NumWords)
+
+		TArray<bool, TInlineAllocator<32>> Evaluated;
+		Evaluated.SetNumZeroed(NumInstructions);
+
+		uint64* FullMask = LiveMasks.GetData() + NumInstructions * NumWords;
+		for (int w = 0; w < NumWords; ++w) { FullMask[w] = ~0ull; }
+		FullMask[NumWords - 1] &= GetTailMask(Count);
+
+		FScope Scope;
+		Scope.StartIndex = StartIndex;
+		Scope.Count = Count;
+		Scope.NumWords = NumWords;
+		Scope.Nodes = InNodes;
+		Scope.Registers = Registers.GetData();
+		Scope.LiveMasks = LiveMasks.GetData();
+		Scope.FullMask = FullMask;
+		Scope.Evaluated = Evaluated.GetData();
+
+		EvaluateRegister(Root, FullMask, Scope);
+
+		FMemory::Memcpy(OutBits, Registers.GetData() + Root * NumWords, NumWords * sizeof(uint64));
+	}
+
+	void FFilterProgram::EvaluateRegister(const int32 InRegister, const uint64* InLive, FScope& InScope) const
+	{
+		if (InScope.Evaluated[InRegister]) { return; }
+		InScope.Evaluated[InRegister] = true;
+
+		const FFilterInstruction& Instruction = Instructions[InRegister];
+		const int32 NumWords = InScope.NumWords;
+		uint64* Dst = InScope.Registers + InRegister * NumWords;
+
+		// Registers read by several instructions must hold every bit, not only the ones live for their first reader
+		if (Instruction.NumUses > 1) { InLive = InScope.FullMask; }
+
+		switch (Instruction.Op)
+		{
+		case EFilterOp::Test:
+			if (InScope.Nodes)
+			{
+				// Per-node tests are scalar, so skipping already decided nodes is a straight saving
+				const PCGExCluster::FNode* ScopeNodes = InScope.Nodes + InScope.StartIndex;
+				PackBits(InScope.Count, Dst, [&](const int32 i) { return GetBit(InLive, i) && Instruction.Filter->Test(ScopeNodes[i]); });
+			}
+			else if (AnyBits(InLive, NumWords))
+			{
+				// Batched tests stay batched; only fully decided scopes are skipped
+				Instruction.Filter->TestScope(InScope.StartIndex, InScope.Count, Dst);
+			}
+			else
+			{
+				FMemory::Memzero(Dst, NumWords * sizeof(uint64));
+			}
+			break;
+		case EFilterOp::Const:
+			for (int w = 0; w < NumWords; ++w) { Dst[w] = Instruction.bConstValue ? ~0ull : 0; }
+			Dst[NumWords - 1] &= GetTailMask(InScope.Count);
+			break;
+		case EFilterOp::Not:
+			{
+				const int32 Operand = Operands[Instruction.FirstOperand];
+				EvaluateRegister(Operand, InLive, InScope);
+				FMemory::Memcpy(Dst, InScope.Registers + Operand * NumWords, NumWords * sizeof(uint64));
+				InvertBits(Dst, InScope.Count);
+			}
+			break;
+		case EFilterOp::And:
+		case EFilterOp::Or:
+			{
+				const bool bIsAND = Instruction.Op == EFilterOp::And;
+
+				// Points decided by an operand (false for AND, true for OR) are no longer live for the following ones
+				uint64* Live = InScope.LiveMasks + InRegister * NumWords;
+				FMemory::Memcpy(Live, InLive, NumWords * sizeof(uint64));
+
+				for (int o = 0; o < Instruction.NumOperands; ++o)
+				{
+					const int32 Operand = Operands[Instruction.FirstOperand + o];
+					EvaluateRegister(Operand, Live, InScope);
+					const uint64* Src = InScope.Registers + Operand * NumWords;
+
+					if (o == 0) { FMemory::Memcpy(Dst, Src, NumWords * sizeof(uint64)); }
+					else if (bIsAND) { for (int w = 0; w < NumWords; ++w) { Dst[w] &= Src[w]; } }
+					else { for (int w = 0; w < NumWords; ++w) { Dst[w] |= Src[w]; } }
+
+					if (bIsAND) { for (int w = 0; w < NumWords; ++w) { Live[w] &= Dst[w]; } }
+					else { for (int w = 0; w < NumWords; ++w) { Live[w] &= ~Dst[w]; } }
+
+					if (!AnyBits(Live, NumWords)) { break; }
+				}
+			}
+			break;
+		}
+	}
+
+	int32 FFilterProgram::CompileFilter(const TFilter* InFilter)
+	{
+		// Identical factories yield identical results
+		if (const int32* Existing = CompiledFactories.Find(InFilter->Factory)) { return *Existing; }
+
+		int32 Register;
+
+		if (InFilter->GetFilterType() == PCGExFilters::EType::Group)
+		{
+			const PCGExFilterGroup::TFilterGroup* Group = static_cast<const PCGExFilterGroup::TFilterGroup*>(InFilter);
+
+			TArray<int32> Registers;
+			Registers.Reserve(Group->GetManagedFilters().Num());
+			for (const TFilter* Filter : Group->GetManagedFilters()) { Registers.Add(CompileFilter(Filter)); }
+
+			Register = CompileCombine(Group->GetMode() == EPCGExFilterGroupMode::OR ? EFilterOp::Or : EFilterOp::And, Registers);
+			if (Group->bInvert) { Register = EmitNot(Register); }
+		}
+		else
+		{
+			bool bConstValue = false;
+			if (InFilter->IsConstant(bConstValue))
+			{
+				Register = EmitConst(bConstValue);
+			}
+			else
+			{
+				FFilterInstruction& Instruction = Instructions.Emplace_GetRef();
+				Instruction.Op = EFilterOp::Test;
+				Instruction.Filter = InFilter;
+				Register = Instructions.Num() - 1;
+			}
+		}
+
+		CompiledFactories.Add(InFilter->Factory, Register);
+		return Register;
+	}
+
+	int32 FFilterProgram::CompileCombine(const EFilterOp InOp, const TArray<int32>& InRegisters)
+	{
+		// Neutral element is true for AND, false for OR; absorbing element is the opposite.
+		const bool bNeutral = InOp == EFilterOp::And;
+
+		TArray<int32> Kept;
+		Kept.Reserve(InRegisters.Num());
+
+		for (const int32 Register : InRegisters)
+		{
+			bool bConstValue = false;
+			if (GetConst(Register, bConstValue))
+			{
+				if (bConstValue == bNeutral) { continue; }
+				return EmitConst(!bNeutral);
+			}
+
+			// Flatten nested groups of the same kind
+			const FFilterInstruction& Operand = Instructions[Register];
+			if (Operand.Op == InOp)
+			{
+				for (int o = 0; o < Operand.NumOperands; ++o) { Kept.AddUnique(Operands[Operand.FirstOperand + o]); }
+				continue;
+			}
+
+			Kept.AddUnique(Register);
+		}
+
+		if (Kept.IsEmpty()) { return EmitConst(bNeutral); }
+		if (Kept.Num() == 1) { return Kept[0]; }
+
+		FFilterInstruction& Instruction = Instructions.Emplace_GetRef();
+		Instruction.Op = InOp;
+		Instruction.FirstOperand = Operands.Num();
+		Instruction.NumOperands = Kept.Num();
+		Operands.Append(Kept);
+
+		return Instructions.Num() - 1;
+	}
+
+	int32 FFilterProgram::EmitConst(const bool bValue)
+	{
+		int32& Register = ConstRegisters[bValue ? 1 : 0];
+		if (Register != -1) { return Register; }
+
+		FFilterInstruction& Instruction = Instructions.Emplace_GetRef();
+		Instruction.Op = EFilterOp::Const;
+		Instruction.bConstValue = bValue;
+		Register = Instructions.Num() - 1;
+
+		return Register;
+	}
+
+	int32 FFilterProgram::EmitNot(const int32 InRegister)
+	{
+		bool bConstValue = false;
+		if (GetConst(InRegister, bConstValue)) { return EmitConst(!bConstValue); }
+
+		const FFilterInstruction& Operand = Instructions[InRegister];
+		if (Operand.Op == EFilterOp::Not) { return Operands[Operand.FirstOperand]; }
+
+		FFilterInstruction& Instruction = Instructions.Emplace_GetRef();
+		Instruction.Op = EFilterOp::Not;
+		Instruction.FirstOperand = Operands.Num();
+		Instruction.NumOperands = 1;
+		Operands.Add(InRegister);
+
+		return Instructions.Num() - 1;
+	}
+
+	bool FFilterProgram::GetConst(const int32 InRegister, bool& OutValue) const
+	{
+		if (!Instructions.IsValidIndex(InRegister) || Instructions[InRegister].Op != EFilterOp::Const) { return false; }
+		OutValue = Instructions[InRegister].bConstValue;
+		return true;
+	}
+}
@@ -3,6 +3,8 @@
 
 #include "Data/PCGExPointFilter.h"
 
+#include "Data/PCGExFilterProgram.h"
+
 #include "Graph/PCGExCluster.h"
 
 PCGExPointFilter::TFilter* UPCGExFilterFactoryBase::CreateFilter() const
@@ -35,6 +37,11 @@ namespace PCGExPointFilter
 	bool TFilter::Test(const PCGExCluster::FNode& Node) const { return Test(Node.PointIndex); }
 	bool TFilter::Test(const PCGExGraph::FIndexedEdge& Edge) const { return Test(Edge.PointIndex); }
 
+	void TFilter::TestScope(const int32 StartIndex, const int32 Count, uint64* OutBits) const
+	{
+		PackBits(Count, OutBits, [&](const int32 i) { return Test(StartIndex + i); });
+	}
+
 	TManager::TManager(PCGExData::FFacade* InPointDataFacade)
 		: PointDataFacade(InPointDataFacade)
 	{
@@ -75,6 +82,36 @@ namespace PCGExPointFilter
 		return true;
 	}
 
+	void TManager::TestScope(const int32 StartIndex, const int32 Count, uint64* OutBits)
+	{
+		if (!Program)
+		{
+			for (int w = 0; w < GetNumWords(Count); ++w) { OutBits[w] = ~0ull; }
+			if (Count) { OutBits[GetNumWords(Count) - 1] &= GetTailMask(Count); }
+			return;
+		}
+
+		Program->Evaluate(StartIndex, Count, OutBits);
+	}
+
+	void TManager::TestScope(const PCGExCluster::FNode* InNodes, const int32 StartIndex, const int32 Count, uint64* OutBits)
+	{
+		if (!Program)
+		{
+			for (int w = 0; w < GetNumWords(Count); ++w) { OutBits[w] = ~0ull; }
+			if (Count) { OutBits[GetNumWords(Count) - 1] &= GetTailMask(Count); }
+			return;
+		}
+
+		Program->Evaluate(StartIndex, Count, OutBits, InNodes);
+	}
+
+	TManager::~TManager()
+	{
+		PCGEX_DELETE(Program)
+		PCGEX_DELETE_TARRAY(ManagedFilters)
+	}
+
 	bool TManager::InitFilter(const FPCGContext* InContext, TFilter* Filter)
 	{
 		return Filter->Init(InContext, PointDataFacade);
@@ -97,6 +134,10 @@ namespace PCGExPointFilter
 			PostInitFilter(InContext, Filter);
 		}
 
+		// Flatten the filter tree for batched evaluation
+		Program = new FFilterProgram();
+		Program->Compile(ManagedFilters);
+
 		if (bCacheResults) { InitCache(); }
 
 		return true;
@@ -112,4 +153,40 @@ namespace PCGExPointFilter
 		const int32 NumResults = PointDataFacade->Source->GetNum();
 		Results.Init(false, NumResults);
 	}
+
+	void TestScopeAND(const TArray<TFilter*>& InFilters, const int32 StartIndex, const int32 Count, uint64* OutBits)
+	{
+		const int32 NumWords = GetNumWords(Count);
+		InFilters[0]->TestScope(StartIndex, Count, OutBits);
+
+		if (InFilters.Num() == 1) { return; }
+
+		TArray<uint64, TInlineAllocator<32>> ChildBits;
+		PCGEX_SET_NUM_UNINITIALIZED(ChildBits, NumWords)
+
+		for (int f = 1; f < InFilters.Num(); ++f)
+		{
+			if (!AnyBits(OutBits, NumWords)) { return; }
+			InFilters[f]->TestScope(StartIndex, Count, ChildBits.GetData());
+			for (int w = 0; w < NumWords; ++w) { OutBits[w] &= ChildBits[w]; }
+		}
+	}
+
+	void TestScopeOR(const TArray<TFilter*>& InFilters, const int32 StartIndex, const int32 Count, uint64* OutBits)
+	{
+		const int32 NumWords = GetNumWords(Count);
+		InFilters[0]->TestScope(StartIndex, Count, OutBits);
+
+		if (InFilters.Num() == 1) { return; }
+
+		TArray<uint64, TInlineAllocator<32>> ChildBits;
+		PCGEX_SET_NUM_UNINITIALIZED(ChildBits, NumWords)
+
+		for (int f = 1; f < InFilters.Num(); ++f)
+		{
+			if (AllBits(OutBits, Count)) { return; }
+			InFilters[f]->TestScope(StartIndex, Count, ChildBits.GetData());
+			for (int w = 0; w < NumWords; ++w) { OutBits[w] |= ChildBits[w]; }
+		}
+	}
 }
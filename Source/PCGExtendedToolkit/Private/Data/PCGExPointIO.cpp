@@ -108,6 +108,17 @@ namespace PCGExData
 		for (int i = 0; i < PointList.Num(); ++i) { InMap.Add(PointList[i].MetadataEntry, i); }
 	}
 
+	void FPointIO::PrintInKeysMap(PCGEx::FIndexLookup& InLookup)
+	{
+		CreateInKeys();
+		const TArray<FPCGPoint>& PointList = In->GetPoints();
+
+		TArray<PCGMetadataEntryKey> Keys;
+		PCGEX_SET_NUM_UNINITIALIZED(Keys, PointList.Num())
+		for (int i = 0; i < PointList.Num(); ++i) { Keys[i] = PointList[i].MetadataEntry; }
+		InLookup.InitFromKeys(Keys);
+	}
+
 	FPCGAttributeAccessorKeysPoints* FPointIO::CreateOutKeys()
 	{
 		if (!OutKeys)
@@ -141,6 +152,26 @@ namespace PCGExData
 		}
 	}
 
+	void FPointIO::PrintOutKeysMap(PCGEx::FIndexLookup& InLookup, const bool bInitializeOnSet)
+	{
+		TArray<FPCGPoint>& PointList = Out->GetMutablePoints();
+
+		TArray<PCGMetadataEntryKey> Keys;
+		PCGEX_SET_NUM_UNINITIALIZED(Keys, PointList.Num())
+
+		for (int i = 0; i < PointList.Num(); ++i)
+		{
+			FPCGPoint& Point = PointList[i];
+			if (bInitializeOnSet) { Out->Metadata->InitializeOnSet(Point.MetadataEntry); }
+			Keys[i] = Point.MetadataEntry;
+		}
+
+		CreateOutKeys();
+
+		// Freshly initialized entries are sequential, which makes for a dense lookup
+		InLookup.InitFromKeys(Keys);
+	}
+
 	FPCGAttributeAccessorKeysPoints* FPointIO::CreateKeys(const ESource InSource)
 	{
 		return InSource == ESource::In ? CreateInKeys() : CreateOutKeys();
@@ -5,6 +5,7 @@
 #include "Data/PCGExPointIOMerger.h"
 
 #include "PCGExGlobalSettings.h"
+#include "Algo/BinarySearch.h"
 #include "Data/PCGExDataFilter.h"
 
 FPCGExPointIOMerger::FPCGExPointIOMerger(PCGExData::FPointIO* OutMergedData)
@@ -47,7 +48,6 @@ void FPCGExPointIOMerger::Append(PCGExData::FPointIOCollection* InCollection)
 void FPCGExPointIOMerger::Merge(PCGExMT::FTaskManager* AsyncManager, const FPCGExCarryOverDetails* InCarryOverDetails)
 {
 	CompositeIO->InitializeNum(NumCompositePoints);
-	TArray<FPCGPoint>& MutablePoints = CompositeIO->GetOut()->GetMutablePoints();
 	InCarryOverDetails->Filter(CompositeIO);
 
 	TMap<FName, EPCGMetadataTypes> ExpectedTypes;
@@ -60,19 +60,6 @@ void FPCGExPointIOMerger::Merge(PCGExMT::FTaskManager* AsyncManager, const FPCGE
 		CompositeIO->Tags->Append(Source->Tags);
 		Source->CreateInKeys();
 
-		const TArray<FPCGPoint>& SourcePoints = Source->GetIn()->GetPoints();
-
-		const uint32 StartIndex = PCGEx::H64A(Scopes[i]);
-
-		// Copy source points -- TODO : could be made async if we split in two steps (merge points then merge attributes)
-		for (int j = 0; j < SourcePoints.Num(); ++j)
-		{
-			const int32 TargetIndex = StartIndex + j;
-			const PCGMetadataEntryKey Key = MutablePoints[TargetIndex].MetadataEntry;
-			MutablePoints[TargetIndex] = SourcePoints[j];
-			MutablePoints[TargetIndex].MetadataEntry = Key;
-		}
-
 		// Discover attributes
 		UPCGMetadata* Metadata = Source->GetIn()->Metadata;
 		TArray<PCGEx::FAttributeIdentity> SourceAttributes;
@@ -117,9 +104,48 @@ void FPCGExPointIOMerger::Merge(PCGExMT::FTaskManager* AsyncManager, const FPCGE
 	InCarryOverDetails->Filter(CompositeIO);
 	CompositeIO->CreateOutKeys();
 
+	// Points & attributes are merged in separate steps :
+	// Scopes are already prefix-summed offsets, so point ranges can be copied in parallel chunks
+	// while attribute values are gathered into writers. Metadata entries are only read when writers are written.
+
+	PCGEX_ASYNC_GROUP(AsyncManager, MergePointsGroup)
+	MergePointsGroup->SetOnIterationRangeStartCallback(
+		[&](const int32 StartIndex, const int32 Count, const int32 LoopIdx) { CopyPoints(StartIndex, Count); });
+	MergePointsGroup->PrepareRangesOnly(NumCompositePoints, GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+
 	for (int i = 0; i < UniqueIdentities.Num(); ++i) { AsyncManager->Start<PCGExPointIOMerger::FWriteAttributeTask>(i, CompositeIO, this); }
 }
 
+void FPCGExPointIOMerger::CopyPoints(const int32 StartIndex, const int32 Count)
+{
+	TArray<FPCGPoint>& MutablePoints = CompositeIO->GetOut()->GetMutablePoints();
+
+	const int32 EndIndex = StartIndex + Count;
+	int32 SourceIndex = Algo::UpperBoundBy(Scopes, static_cast<uint32>(StartIndex), [](const uint64 Scope) { return PCGEx::H64A(Scope); }) - 1;
+	int32 TargetIndex = StartIndex;
+
+	// A chunk may straddle several sources
+	while (TargetIndex < EndIndex)
+	{
+		uint32 SourceStart;
+		uint32 SourceCount;
+		PCGEx::H64(Scopes[SourceIndex], SourceStart, SourceCount);
+
+		const FPCGPoint* SourcePoints = IOSources[SourceIndex]->GetIn()->GetPoints().GetData();
+		const int32 LastIndex = FMath::Min(EndIndex, static_cast<int32>(SourceStart + SourceCount));
+
+		for (; TargetIndex < LastIndex; ++TargetIndex)
+		{
+			FPCGPoint& Point = MutablePoints[TargetIndex];
+			const PCGMetadataEntryKey Key = Point.MetadataEntry;
+			Point = SourcePoints[TargetIndex - SourceStart];
+			Point.MetadataEntry = Key;
+		}
+
+		SourceIndex++;
+	}
+}
+
 void FPCGExPointIOMerger::Write()
 {
 	for (int i = 0; i < UniqueIdentities.Num(); ++i)
@@ -0,0 +1,188 @@
+﻿// Copyright Timothé Lapetite 2024
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Data/PCGExSpatialIndexCache.h"
+
+#include "PCGExGlobalSettings.h"
+#include "PCGExMacros.h"
+#include "Data/PCGPointData.h"
+
+namespace PCGExData
+{
+	FSpatialIndexCache& FSpatialIndexCache::Get()
+	{
+		static FSpatialIndexCache Instance;
+		return Instance;
+	}
+
+	FSpatialIndexCache::~FSpatialIndexCache()
+	{
+		for (const TPair<FKey, FEntry*>& Pair : Entries)
+		{
+			DeleteIndex(Pair.Value);
+			delete Pair.Value;
+		}
+
+		Entries.Empty();
+		EntriesByIndex.Empty();
+	}
+
+	const PCGExGeo::FKDTree* FSpatialIndexCache::AcquireKDTree(const UPCGPointData* InData)
+	{
+		const FKey Key{InData->UID, 0, ESpatialIndexKind::PositionKDTree};
+		if (const void* Cached = TryAcquire(Key)) { return static_cast<const PCGExGeo::FKDTree*>(Cached); }
+
+		const TArray<FPCGPoint>& Points = InData->GetPoints();
+
+		TArray<FVector> Positions;
+		PCGEX_SET_NUM_UNINITIALIZED(Positions, Points.Num())
+		for (int i = 0; i < Points.Num(); ++i) { Positions[i] = Points[i].Transform.GetLocation(); }
+
+		const PCGExGeo::FKDTree* NewIndex = new PCGExGeo::FKDTree(Positions);
+		return static_cast<const PCGExGeo::FKDTree*>(Register(Key, InData, NewIndex, NewIndex->GetAllocatedSize()));
+	}
+
+	const PCGExGeo::FPointHashGrid* FSpatialIndexCache::AcquireGrid(const UPCGPointData* InData, const double CellSize)
+	{
+		uint64 CellSizeBits = 0;
+		FMemory::Memcpy(&CellSizeBits, &CellSize, sizeof(double));
+
+		const FKey Key{InData->UID, CellSizeBits, ESpatialIndexKind::PositionGrid};
+		if (const void* Cached = TryAcquire(Key)) { return static_cast<const PCGExGeo::FPointHashGrid*>(Cached); }
+
+		const TArray<FPCGPoint>& Points = InData->GetPoints();
+
+		TArray<FVector> Positions;
+		TArray<int32> Items;
+		PCGEX_SET_NUM_UNINITIALIZED(Positions, Points.Num())
+		PCGEX_SET_NUM_UNINITIALIZED(Items, Points.Num())
+		for (int i = 0; i < Points.Num(); ++i)
+		{
+			Positions[i] = Points[i].Transform.GetLocation();
+			Items[i] = i;
+		}
+
+		const PCGExGeo::FPointHashGrid* NewIndex = new PCGExGeo::FPointHashGrid(CellSize, Positions, Items);
+		return static_cast<const PCGExGeo::FPointHashGrid*>(Register(Key, InData, NewIndex, NewIndex->GetAllocatedSize()));
+	}
+
+	void FSpatialIndexCache::Release(const void* InIndex)
+	{
+		if (!InIndex) { return; }
+
+		FWriteScopeLock WriteScopeLock(CacheLock);
+
+		FEntry** EntryPtr = EntriesByIndex.Find(InIndex);
+		if (!EntryPtr) { return; }
+
+		FEntry* Entry = *EntryPtr;
+		Entry->RefCount--;
+
+		const UPCGExGlobalSettings* GlobalSettings = GetDefault<UPCGExGlobalSettings>();
+		EvictUnused(GlobalSettings->bCacheSpatialIndices ? static_cast<SIZE_T>(GlobalSettings->SpatialIndexCacheBudget) << 20 : 0);
+	}
+
+	void FSpatialIndexCache::Flush()
+	{
+		FWriteScopeLock WriteScopeLock(CacheLock);
+		EvictUnused(0);
+	}
+
+	const void* FSpatialIndexCache::TryAcquire(const FKey& Key)
+	{
+		if (!GetDefault<UPCGExGlobalSettings>()->bCacheSpatialIndices) { return nullptr; }
+
+		FWriteScopeLock WriteScopeLock(CacheLock);
+
+		FEntry** EntryPtr = Entries.Find(Key);
+		if (!EntryPtr) { return nullptr; }
+
+		FEntry* Entry = *EntryPtr;
+		Entry->RefCount++;
+		Entry->LastUse = ++UseCounter;
+		return Entry->Index;
+	}
+
+	const void* FSpatialIndexCache::Register(const FKey& Key, const UPCGPointData* InData, const void* InIndex, const SIZE_T InSize)
+	{
+		FWriteScopeLock WriteScopeLock(CacheLock);
+
+		if (FEntry** EntryPtr = Entries.Find(Key))
+		{
+			// Built concurrently by another node, keep the first one
+			FEntry Discarded;
+			Discarded.Key = Key;
+			Discarded.Index = InIndex;
+			DeleteIndex(&Discarded);
+
+			FEntry* Entry = *EntryPtr;
+			Entry->RefCount++;
+			Entry->LastUse = ++UseCounter;
+			return Entry->Index;
+		}
+
+		FEntry* Entry = new FEntry();
+		Entry->Key = Key;
+		Entry->Data = InData;
+		Entry->Index = InIndex;
+		Entry->Size = InSize;
+		Entry->RefCount = 1;
+		Entry->LastUse = ++UseCounter;
+
+		Entries.Add(Key, Entry);
+		EntriesByIndex.Add(InIndex, Entry);
+		TotalSize += InSize;
+
+		return InIndex;
+	}
+
+	void FSpatialIndexCache::EvictUnused(const SIZE_T Budget)
+	{
+		// Indices over data that's gone can never be hit again
+		TArray<FEntry*> Orphans;
+		for (const TPair<FKey, FEntry*>& Pair : Entries)
+		{
+			if (Pair.Value->RefCount <= 0 && !Pair.Value->Data.IsValid()) { Orphans.Add(Pair.Value); }
+		}
+
+		for (FEntry* Orphan : Orphans) { RemoveEntry(Orphan); }
+
+		while (TotalSize > Budget)
+		{
+			FEntry* Oldest = nullptr;
+			for (const TPair<FKey, FEntry*>& Pair : Entries)
+			{
+				if (Pair.Value->RefCount > 0) { continue; }
+				if (!Oldest || Pair.Value->LastUse < Oldest->LastUse) { Oldest = Pair.Value; }
+			}
+
+			if (!Oldest) { return; } // Everything left is in use
+
+			RemoveEntry(Oldest);
+		}
+	}
+
+	void FSpatialIndexCache::RemoveEntry(FEntry* Entry)
+	{
+		Entries.Remove(Entry->Key);
+		EntriesByIndex.Remove(Entry->Index);
+		TotalSize -= Entry->Size;
+
+		DeleteIndex(Entry);
+		delete Entry;
+	}
+
+	void FSpatialIndexCache::DeleteIndex(const FEntry* Entry)
+	{
+		switch (Entry->Key.Kind)
+		{
+		case ESpatialIndexKind::PositionKDTree:
+			delete static_cast<const PCGExGeo::FKDTree*>(Entry->Index);
+			break;
+		case ESpatialIndexKind::PositionGrid:
+			delete static_cast<const PCGExGeo::FPointHashGrid*>(Entry->Index);
+			break;
+		default: ;
+		}
+	}
+}
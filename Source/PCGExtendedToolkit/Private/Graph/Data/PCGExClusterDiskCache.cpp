@@ -0,0 +1,394 @@
+﻿// Copyright Timothé Lapetite 2024
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Graph/Data/PCGExClusterDiskCache.h"
+
+#include "PCGExGlobalSettings.h"
+#include "PCGExMacros.h"
+#include "Async/MappedFileHandle.h"
+#include "Data/PCGExAttributeHelpers.h"
+#include "Data/PCGExPointIO.h"
+#include "Graph/PCGExCluster.h"
+#include "Graph/PCGExEdge.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace PCGExClusterData
+{
+	namespace DiskCache
+	{
+		constexpr uint32 Magic = 0x43584750; // PGXC
+		constexpr uint32 Version = 3;
+
+		// Followed by, in that order :
+		// Neighbors[NumNeighbors] (uint64, CSR rows), Edges[NumEdges] (uint64, H64(StartPoint, EndPoint)),
+		// NodePointIndices[NumNodes] (int32), Offsets[NumNodes + 1] (int32, CSR row starts).
+		// 8-byte blocks come first so every block stays aligned within the mapped file.
+		// Positions aren't stored : they're read back from the vtx points, which the key doesn't cover.
+		struct FHeader
+		{
+			uint32 Magic = 0;
+			uint32 Version = 0;
+			uint64 Key = 0;
+			int32 NumRawVtx = 0;
+			int32 NumRawEdges = 0;
+			int32 NumNodes = 0;
+			int32 NumEdges = 0;
+			int32 NumNeighbors = 0;
+			int32 Padding = 0;
+		};
+
+		static_assert(sizeof(FHeader) % 8 == 0, "Cluster cache header must keep blocks aligned");
+
+		static int64 GetExpectedSize(const FHeader& Header)
+		{
+			return sizeof(FHeader)
+				+ static_cast<int64>(Header.NumNeighbors) * sizeof(uint64)
+				+ static_cast<int64>(Header.NumEdges) * sizeof(uint64)
+				+ static_cast<int64>(Header.NumNodes) * sizeof(int32)
+				+ static_cast<int64>(Header.NumNodes + 1) * sizeof(int32);
+		}
+
+	}
+
+	FClusterDiskCache& FClusterDiskCache::Get()
+	{
+		static FClusterDiskCache Instance;
+		return Instance;
+	}
+
+	FClusterDiskCache::FClusterDiskCache()
+	{
+		CacheDir = FPaths::ProjectSavedDir() / TEXT("PCGEx") / TEXT("ClusterCache");
+		IFileManager::Get().MakeDirectory(*CacheDir, true);
+
+		Trim();
+	}
+
+	bool FClusterDiskCache::IsEnabled()
+	{
+		const UPCGExGlobalSettings* Settings = GetDefault<UPCGExGlobalSettings>();
+		return Settings->bCacheClusters && Settings->bCacheClustersOnDisk;
+	}
+
+	uint32 FClusterDiskCache::HashVtx(PCGExData::FPointIO* InVtxIO, const TArray<int32>& InExpectedAdjacency)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FClusterDiskCache::HashVtx);
+
+		const uint32 Crc = FCrc::MemCrc32(
+			InExpectedAdjacency.GetData(), InExpectedAdjacency.Num() * sizeof(int32),
+			HashCombineFast(DiskCache::Version, InVtxIO->GetNum()));
+		return Crc == 0 ? 1 : Crc;
+	}
+
+	uint64 FClusterDiskCache::HashEdges(const uint32 InVtxHash, PCGExData::FPointIO* InEdgesIO, const PCGEx::FIndexLookup& InEndpointsLookup)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FClusterDiskCache::HashEdges);
+
+		PCGEx::TAttributeReader<int64>* Reader = new PCGEx::TAttributeReader<int64>(PCGExGraph::Tag_EdgeEndpoints);
+		if (!Reader->Bind(InEdgesIO))
+		{
+			PCGEX_DELETE(Reader)
+			return 0;
+		}
+
+		// Endpoints embed per-session data UIDs; resolve them to vtx point indices so the key only depends on topology
+		TArray<uint64> Endpoints;
+		PCGEX_SET_NUM_UNINITIALIZED(Endpoints, Reader->Values.Num())
+
+		for (int i = 0; i < Endpoints.Num(); ++i)
+		{
+			uint32 A;
+			uint32 B;
+			PCGEx::H64(Reader->Values[i], A, B);
+
+			const int32* StartIndex = InEndpointsLookup.Find(A);
+			const int32* EndIndex = InEndpointsLookup.Find(B);
+
+			if (!StartIndex || !EndIndex)
+			{
+				PCGEX_DELETE(Reader)
+				return 0;
+			}
+
+			Endpoints[i] = PCGEx::H64(*StartIndex, *EndIndex);
+		}
+
+		PCGEX_DELETE(Reader)
+
+		const uint32 Crc = FCrc::MemCrc32(Endpoints.GetData(), Endpoints.Num() * sizeof(uint64), HashCombineFast(InVtxHash, InEdgesIO->GetNum()));
+		return PCGEx::H64(InVtxHash, Crc == 0 ? 1 : Crc);
+	}
+
+	FString FClusterDiskCache::GetFilePath(const uint64 Key) const
+	{
+		return CacheDir / FString::Printf(TEXT("%016llx.pcgexc"), Key);
+	}
+
+	PCGExCluster::FCluster* FClusterDiskCache::TryLoad(const uint64 Key, PCGExData::FPointIO* InVtxIO, PCGExData::FPointIO* InEdgesIO, const TArray<int32>* InExpectedAdjacency) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FClusterDiskCache::TryLoad);
+
+		const FString Path = GetFilePath(Key);
+		if (!FPaths::FileExists(Path)) { return nullptr; }
+
+		// Prefer a mapping; platforms that can't map files fall back to a plain read
+		TUniquePtr<IMappedFileHandle> MappedHandle(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Path));
+		TUniquePtr<IMappedFileRegion> MappedRegion(MappedHandle ? MappedHandle->MapRegion() : nullptr);
+
+		TArray<uint8> FileData;
+		const uint8* Data = nullptr;
+		int64 DataSize = 0;
+
+		if (MappedRegion)
+		{
+			Data = MappedRegion->GetMappedPtr();
+			DataSize = MappedRegion->GetMappedSize();
+		}
+		else
+		{
+			if (!FFileHelper::LoadFileToArray(FileData, *Path, FILEREAD_Silent)) { return nullptr; }
+			Data = FileData.GetData();
+			DataSize = FileData.Num();
+		}
+
+		if (DataSize < static_cast<int64>(sizeof(DiskCache::FHeader))) { return nullptr; }
+
+		DiskCache::FHeader Header;
+		FMemory::Memcpy(&Header, Data, sizeof(DiskCache::FHeader));
+
+		if (Header.Magic != DiskCache::Magic ||
+			Header.Version != DiskCache::Version ||
+			Header.Key != Key ||
+			Header.NumRawVtx != InVtxIO->GetNum() || Header.NumRawEdges != InEdgesIO->GetNum() ||
+			Header.NumNodes <= 0 || Header.NumNodes > Header.NumRawVtx ||
+			Header.NumEdges <= 0 || Header.NumEdges > Header.NumRawEdges ||
+			Header.NumNeighbors != Header.NumEdges * 2 ||
+			DiskCache::GetExpectedSize(Header) != DataSize)
+		{
+			return nullptr;
+		}
+
+		const int32 NumRawVtx = Header.NumRawVtx;
+		const int32 NumNodes = Header.NumNodes;
+		const int32 NumEdges = Header.NumEdges;
+		const int32 NumNeighbors = Header.NumNeighbors;
+
+		const uint8* Cursor = Data + sizeof(DiskCache::FHeader);
+		const uint64* Neighbors = reinterpret_cast<const uint64*>(Cursor);
+		Cursor += NumNeighbors * sizeof(uint64);
+		const uint64* Edges = reinterpret_cast<const uint64*>(Cursor);
+		Cursor += NumEdges * sizeof(uint64);
+		const int32* PointIndices = reinterpret_cast<const int32*>(Cursor);
+		Cursor += NumNodes * sizeof(int32);
+		const int32* Offsets = reinterpret_cast<const int32*>(Cursor);
+
+		// Keys only cover the inputs, so every index is checked before being trusted
+
+		if (Offsets[0] != 0 || Offsets[NumNodes] != NumNeighbors) { return nullptr; }
+
+		for (int i = 0; i < NumNodes; ++i)
+		{
+			const int32 PointIndex = PointIndices[i];
+			if (Offsets[i + 1] < Offsets[i] || PointIndex < 0 || PointIndex >= NumRawVtx) { return nullptr; }
+			if (InExpectedAdjacency && (*InExpectedAdjacency)[PointIndex] > Offsets[i + 1] - Offsets[i]) { return nullptr; }
+		}
+
+		for (int i = 0; i < NumNeighbors; ++i)
+		{
+			if (PCGEx::H64A(Neighbors[i]) >= static_cast<uint32>(NumNodes) ||
+				PCGEx::H64B(Neighbors[i]) >= static_cast<uint32>(NumEdges))
+			{
+				return nullptr;
+			}
+		}
+
+		for (int i = 0; i < NumEdges; ++i)
+		{
+			if (PCGEx::H64A(Edges[i]) >= static_cast<uint32>(NumRawVtx) ||
+				PCGEx::H64B(Edges[i]) >= static_cast<uint32>(NumRawVtx))
+			{
+				return nullptr;
+			}
+		}
+
+		PCGExCluster::FCluster* NewCluster = new PCGExCluster::FCluster();
+		NewCluster->VtxIO = InVtxIO;
+		NewCluster->EdgesIO = InEdgesIO;
+		NewCluster->NumRawVtx = NumRawVtx;
+		NewCluster->NumRawEdges = Header.NumRawEdges;
+
+		NewCluster->NodeIndexLookup->InitFromKeys(TArrayView<const int32>(PointIndices, NumNodes));
+
+		PCGExCluster::FAdjacencyCSR* CSR = new PCGExCluster::FAdjacencyCSR();
+		CSR->Offsets.Append(Offsets, NumNodes + 1);
+		CSR->Neighbors.Append(Neighbors, NumNeighbors);
+		NewCluster->AdjacencyCSR = CSR;
+
+		// FNode keeps its own adjacency, rows are appended straight from the mapped CSR
+		const TArray<FPCGPoint>& VtxPoints = InVtxIO->GetIn()->GetPoints();
+		TArray<PCGExCluster::FNode>& NodesRef = *NewCluster->Nodes;
+		NodesRef.Reserve(NumNodes);
+		PCGEX_SET_NUM_UNINITIALIZED(NewCluster->NodePositions, NumNodes)
+
+		FBox Bounds = FBox(ForceInit);
+		for (int i = 0; i < NumNodes; ++i)
+		{
+			PCGExCluster::FNode& Node = NodesRef.Emplace_GetRef(i, PointIndices[i]);
+			Node.Adjacency.Append(Neighbors + Offsets[i], Offsets[i + 1] - Offsets[i]);
+
+			const FVector Pos = VtxPoints[PointIndices[i]].Transform.GetLocation();
+			NewCluster->NodePositions[i] = Pos;
+			Bounds += Pos;
+		}
+
+		NewCluster->Bounds = Bounds.ExpandBy(10);
+
+		const int32 IOIndex = InEdgesIO->IOIndex;
+		PCGEX_SET_NUM_UNINITIALIZED_PTR(NewCluster->Edges, NumEdges)
+
+		for (int i = 0; i < NumEdges; ++i)
+		{
+			uint32 StartPointIndex;
+			uint32 EndPointIndex;
+			PCGEx::H64(Edges[i], StartPointIndex, EndPointIndex);
+			(*NewCluster->Edges)[i] = PCGExGraph::FIndexedEdge(i, StartPointIndex, EndPointIndex, i, IOIndex);
+		}
+
+		// Mark as recently used so trimming evicts cold files first
+		IFileManager::Get().SetTimeStamp(*Path, FDateTime::UtcNow());
+
+		return NewCluster;
+	}
+
+	void FClusterDiskCache::Save(const uint64 Key, const PCGExCluster::FCluster* InCluster) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FClusterDiskCache::Save);
+
+		const TArray<PCGExCluster::FNode>& Nodes = *InCluster->Nodes;
+		const TArray<PCGExGraph::FIndexedEdge>& Edges = *InCluster->Edges;
+
+		if (Nodes.IsEmpty() || Edges.IsEmpty()) { return; }
+
+		PCGExCluster::FAdjacencyCSR* LocalCSR = InCluster->AdjacencyCSR ? nullptr : new PCGExCluster::FAdjacencyCSR(InCluster);
+		const PCGExCluster::FAdjacencyCSR* CSR = InCluster->AdjacencyCSR ? InCluster->AdjacencyCSR : LocalCSR;
+
+		DiskCache::FHeader Header;
+		Header.Magic = DiskCache::Magic;
+		Header.Version = DiskCache::Version;
+		Header.Key = Key;
+		Header.NumRawVtx = InCluster->NumRawVtx;
+		Header.NumRawEdges = InCluster->NumRawEdges;
+		Header.NumNodes = Nodes.Num();
+		Header.NumEdges = Edges.Num();
+		Header.NumNeighbors = CSR->Neighbors.Num();
+
+		TArray<uint8> Buffer;
+		PCGEX_SET_NUM_UNINITIALIZED(Buffer, DiskCache::GetExpectedSize(Header))
+
+		uint8* Cursor = Buffer.GetData();
+		auto Write = [&](const void* Src, const int64 Size)
+		{
+			FMemory::Memcpy(Cursor, Src, Size);
+			Cursor += Size;
+		};
+
+		Write(&Header, sizeof(DiskCache::FHeader));
+		Write(CSR->Neighbors.GetData(), CSR->Neighbors.Num() * sizeof(uint64));
+
+		for (const PCGExGraph::FIndexedEdge& Edge : Edges)
+		{
+			const uint64 Endpoints = PCGEx::H64(Edge.Start, Edge.End);
+			Write(&Endpoints, sizeof(uint64));
+		}
+
+		for (const PCGExCluster::FNode& Node : Nodes) { Write(&Node.PointIndex, sizeof(int32)); }
+		Write(CSR->Offsets.GetData(), CSR->Offsets.Num() * sizeof(int32));
+
+		PCGEX_DELETE(LocalCSR)
+
+		// Write aside then move in place, so concurrent readers never see a partial file
+		const FString Path = GetFilePath(Key);
+		const FString TempPath = Path + TEXT(".") + FGuid::NewGuid().ToString() + TEXT(".tmp");
+
+		if (!FFileHelper::SaveArrayToFile(Buffer, *TempPath)) { return; }
+		if (!IFileManager::Get().Move(*Path, *TempPath, true, true))
+		{
+			IFileManager::Get().Delete(*TempPath, false, false, true);
+			return;
+		}
+
+		// Re-check the cap once this session wrote an eighth of it
+		const int64 MaxBytes = static_cast<int64>(GetDefault<UPCGExGlobalSettings>()->ClusterDiskCacheMaxSizeMB) << 20;
+		if ((BytesSinceTrim += Buffer.Num()) > MaxBytes / 8) { Trim(); }
+	}
+
+	void FClusterDiskCache::Trim() const
+	{
+		if (!TrimLock.TryWriteLock()) { return; } // Someone else is already trimming
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(FClusterDiskCache::Trim);
+
+		BytesSinceTrim = 0;
+
+		const UPCGExGlobalSettings* Settings = GetDefault<UPCGExGlobalSettings>();
+		const int64 MaxBytes = static_cast<int64>(Settings->ClusterDiskCacheMaxSizeMB) << 20;
+		const FDateTime Now = FDateTime::UtcNow();
+		const FTimespan MaxAge = FTimespan::FromDays(Settings->ClusterDiskCacheMaxAgeDays);
+
+		struct FEntry
+		{
+			FString Path;
+			FDateTime LastUse;
+			int64 Size = 0;
+		};
+
+		TArray<FEntry> Entries;
+		int64 TotalSize = 0;
+
+		IFileManager& FileManager = IFileManager::Get();
+		FileManager.IterateDirectoryStat(
+			*CacheDir, [&](const TCHAR* InPath, const FFileStatData& InStat)
+			{
+				if (InStat.bIsDirectory) { return true; }
+
+				const FString FilePath(InPath);
+				const FTimespan Age = Now - InStat.ModificationTime;
+
+				// Temp files are only leftovers once they're clearly not being written anymore
+				if (FilePath.EndsWith(TEXT(".tmp")))
+				{
+					if (Age > FTimespan::FromHours(1)) { FileManager.Delete(InPath, false, false, true); }
+					return true;
+				}
+
+				if (!FilePath.EndsWith(TEXT(".pcgexc"))) { return true; }
+
+				if (Age > MaxAge)
+				{
+					FileManager.Delete(InPath, false, false, true);
+					return true;
+				}
+
+				Entries.Add({FilePath, InStat.ModificationTime, InStat.FileSize});
+				TotalSize += InStat.FileSize;
+				return true;
+			});
+
+		if (TotalSize > MaxBytes)
+		{
+			// Least recently used first
+			Entries.Sort([](const FEntry& A, const FEntry& B) { return A.LastUse < B.LastUse; });
+			for (const FEntry& Entry : Entries)
+			{
+				if (TotalSize <= MaxBytes) { break; }
+				if (FileManager.Delete(*Entry.Path, false, false, true)) { TotalSize -= Entry.Size; }
+			}
+		}
+
+		TrimLock.WriteUnlock();
+	}
+}
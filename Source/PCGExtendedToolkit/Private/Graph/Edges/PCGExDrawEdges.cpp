@@ -91,7 +91,7 @@ bool FPCGExDrawEdgesElement::ExecuteInternal(
 				             PCGExMath::Lerp(Settings->Color, Settings->SecondaryColor, L) :
 				             Settings->Color;
 
-			const TMap<int32, int32>& NodeIndexLookupRef = *Context->CurrentCluster->NodeIndexLookup;
+			const PCGEx::FIndexLookup& NodeIndexLookupRef = *Context->CurrentCluster->NodeIndexLookup;
 
 			for (const PCGExGraph::FIndexedEdge& Edge : (*Context->CurrentCluster->Edges))
 			{
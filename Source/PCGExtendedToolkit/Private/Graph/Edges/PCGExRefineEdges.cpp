@@ -274,6 +274,18 @@ namespace PCGExRefineEdges
 
 	void FProcessor::InsertEdges() const
 	{
+		if (GraphBuilder && Cluster->bIsOneToOne)
+		{
+			// Sole cluster of this vtx group : edit it in place and let the builder output it directly,
+			// unless refinement split it apart, in which case it needs a proper subgraph search.
+			if (Cluster->RemoveInvalidEdges() == 0) { return; }
+			if (Cluster->IsConnected())
+			{
+				GraphBuilder->SourceCluster = Cluster;
+				return;
+			}
+		}
+
 		TArray<PCGExGraph::FIndexedEdge> ValidEdges;
 		Cluster->GetValidEdges(ValidEdges);
 
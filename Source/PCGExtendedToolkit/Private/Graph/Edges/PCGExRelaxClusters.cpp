@@ -69,8 +69,6 @@ namespace PCGExRelaxClusters
 		PCGEX_DELETE(SecondaryBuffer)
 
 		PCGEX_DELETE_UOBJECT(RelaxOperation)
-
-		//if (bBuildExpandedNodes) { PCGEX_DELETE_TARRAY_FULL(ExpandedNodes) } // Keep those cached since we forward expanded cluster
 	}
 
 	PCGExCluster::FCluster* FProcessor::HandleCachedCluster(const PCGExCluster::FCluster* InClusterRef)
@@ -90,7 +88,7 @@ namespace PCGExRelaxClusters
 		if (!InfluenceDetails.Init(Context, VtxDataFacade)) { return false; }
 
 		RelaxOperation = TypedContext->Relaxing->CopyOperation<UPCGExRelaxClusterOperation>();
-		RelaxOperation->PrepareForCluster(Cluster);
+		RelaxOperation->PrepareForCluster(Cluster); // Builds the cluster's CSR adjacency
 
 		PrimaryBuffer = new TArray<FVector>();
 		SecondaryBuffer = new TArray<FVector>();
@@ -103,19 +101,8 @@ namespace PCGExRelaxClusters
 
 		for (int i = 0; i < NumNodes; ++i) { PBufferRef[i] = SBufferRef[i] = Cluster->GetPos(i); }
 
-		ExpandedNodes = Cluster->ExpandedNodes;
 		Iterations = Settings->Iterations;
-
-		if (!ExpandedNodes)
-		{
-			ExpandedNodes = Cluster->GetExpandedNodes(false);
-			bBuildExpandedNodes = true;
-			StartParallelLoopForRange(NumNodes);
-		}
-		else
-		{
-			StartRelaxIteration();
-		}
+		StartRelaxIteration();
 
 		return true;
 	}
@@ -137,14 +124,9 @@ namespace PCGExRelaxClusters
 			nullptr, this);
 	}
 
-	void FProcessor::ProcessSingleRangeIteration(const int32 Iteration, const int32 LoopIdx, const int32 Count)
-	{
-		(*ExpandedNodes)[Iteration] = new PCGExCluster::FExpandedNode(Cluster, Iteration);
-	}
-
 	void FProcessor::ProcessSingleNode(const int32 Index, PCGExCluster::FNode& Node, const int32 LoopIdx, const int32 Count)
 	{
-		RelaxOperation->ProcessExpandedNode(*(ExpandedNodes->GetData() + Index));
+		RelaxOperation->ProcessNode(Index);
 
 		if (!InfluenceDetails.bProgressiveInfluence) { return; }
 
@@ -154,12 +136,6 @@ namespace PCGExRelaxClusters
 			InfluenceDetails.GetInfluence(Node.PointIndex));
 	}
 
-	void FProcessor::CompleteWork()
-	{
-		if (!bBuildExpandedNodes) { return; }
-		StartRelaxIteration();
-	}
-
 	void FProcessor::Write()
 	{
 		PCGEX_TYPED_CONTEXT_AND_SETTINGS(RelaxClusters)
@@ -5,6 +5,7 @@
 
 #include "Data/PCGExAttributeHelpers.h"
 #include "Geometry/PCGExGeo.h"
+#include "Algo/Sort.h"
 #include "Graph/Data/PCGExClusterData.h"
 
 #pragma region UPCGExNodeStateDefinition
@@ -64,11 +65,70 @@ namespace PCGExCluster
 
 #pragma endregion
 
+#pragma region FAdjacencyCSR
+
+	FAdjacencyCSR::FAdjacencyCSR(const FCluster* InCluster)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FAdjacencyCSR::Build);
+
+		const TArray<FNode>& NodesRef = *InCluster->Nodes;
+		const int32 NumNodes = NodesRef.Num();
+		const TArray<PCGExGraph::FIndexedEdge>& EdgesRef = *InCluster->Edges;
+		const PCGEx::FIndexLookup& LookupRef = *InCluster->NodeIndexLookup;
+
+		// Count degrees while resolving endpoints once, then scatter into rows.
+		// Edges are walked in order, so each row matches the order FNode::Adjacency was built in.
+		// Invalid edges, or edges touching an invalid node, are flagged with a -1 endpoint and skipped by both passes.
+
+		TArray<int32> Endpoints;
+		PCGEX_SET_NUM_UNINITIALIZED(Endpoints, EdgesRef.Num() * 2)
+
+		Offsets.Init(0, NumNodes + 1);
+
+		for (int i = 0; i < EdgesRef.Num(); ++i)
+		{
+			const PCGExGraph::FIndexedEdge& E = EdgesRef[i];
+			const int32 A = LookupRef[E.Start];
+			const int32 B = LookupRef[E.End];
+
+			if (!E.bValid || !NodesRef[A].bValid || !NodesRef[B].bValid)
+			{
+				Endpoints[i * 2] = -1;
+				continue;
+			}
+
+			Endpoints[i * 2] = A;
+			Endpoints[i * 2 + 1] = B;
+			Offsets[A + 1]++;
+			Offsets[B + 1]++;
+		}
+
+		for (int i = 0; i < NumNodes; ++i) { Offsets[i + 1] += Offsets[i]; }
+
+		PCGEX_SET_NUM_UNINITIALIZED(Neighbors, Offsets[NumNodes])
+
+		TArray<int32> Cursor;
+		Cursor.Append(Offsets.GetData(), NumNodes);
+
+		for (int i = 0; i < EdgesRef.Num(); ++i)
+		{
+			const int32 A = Endpoints[i * 2];
+			if (A == -1) { continue; }
+
+			const int32 EdgeIndex = EdgesRef[i].EdgeIndex;
+			const int32 B = Endpoints[i * 2 + 1];
+			Neighbors[Cursor[A]++] = PCGEx::H64(B, EdgeIndex);
+			Neighbors[Cursor[B]++] = PCGEx::H64(A, EdgeIndex);
+		}
+	}
+
+#pragma endregion
+
 #pragma region FCluster
 
 	FCluster::FCluster()
 	{
-		NodeIndexLookup = new TMap<int32, int32>();
+		NodeIndexLookup = new PCGEx::FIndexLookup();
 		Nodes = new TArray<FNode>();
 		Edges = new TArray<PCGExGraph::FIndexedEdge>();
 		Bounds = FBox(ForceInit);
@@ -126,8 +186,7 @@ namespace PCGExCluster
 
 		if (bCopyLookup)
 		{
-			NodeIndexLookup = new TMap<int32, int32>();
-			NodeIndexLookup->Append(*OtherCluster->NodeIndexLookup);
+			NodeIndexLookup = new PCGEx::FIndexLookup(*OtherCluster->NodeIndexLookup);
 		}
 		else
 		{
@@ -149,11 +208,18 @@ namespace PCGExCluster
 		VtxPointIndices = OtherCluster->VtxPointIndices;
 		if (VtxPointIndices) { bOwnsVtxPointIndices = false; }
 
-		NodeOctree = OtherCluster->NodeOctree;
-		if (NodeOctree) { bOwnsNodeOctree = false; }
+		NodeKDTree = OtherCluster->NodeKDTree;
+		if (NodeKDTree) { bOwnsNodeKDTree = false; }
 
-		EdgeOctree = OtherCluster->EdgeOctree;
-		if (EdgeOctree) { bOwnsEdgeOctree = false; }
+		EdgeBVH = OtherCluster->EdgeBVH;
+		if (EdgeBVH) { bOwnsEdgeBVH = false; }
+
+		if (!bCopyNodes && !bCopyEdges)
+		{
+			// Topology is shared as-is
+			AdjacencyCSR = OtherCluster->AdjacencyCSR;
+			if (AdjacencyCSR) { bOwnsAdjacencyCSR = false; }
+		}
 	}
 
 	void FCluster::ClearInheritedForChanges(const bool bClearOwned)
@@ -187,24 +253,24 @@ namespace PCGExCluster
 			PCGEX_DELETE(EdgeLengths)
 		}
 
-		if (!bOwnsNodeOctree)
+		if (!bOwnsNodeKDTree)
 		{
-			NodeOctree = nullptr;
-			bOwnsNodeOctree = true;
+			NodeKDTree = nullptr;
+			bOwnsNodeKDTree = true;
 		}
-		else if (bClearOwned && NodeOctree)
+		else if (bClearOwned && NodeKDTree)
 		{
-			PCGEX_DELETE(NodeOctree)
+			PCGEX_DELETE(NodeKDTree)
 		}
 
-		if (!bOwnsEdgeOctree)
+		if (!bOwnsEdgeBVH)
 		{
-			EdgeOctree = nullptr;
-			bOwnsEdgeOctree = true;
+			EdgeBVH = nullptr;
+			bOwnsEdgeBVH = true;
 		}
-		else if (bClearOwned && EdgeOctree)
+		else if (bClearOwned && EdgeBVH)
 		{
-			PCGEX_DELETE(EdgeOctree)
+			PCGEX_DELETE(EdgeBVH)
 		}
 
 		if (!bOwnsExpandedNodes)
@@ -235,8 +301,9 @@ namespace PCGExCluster
 		if (bOwnsEdges) { PCGEX_DELETE(Edges) }
 		if (bOwnsLengths) { PCGEX_DELETE(EdgeLengths) }
 		if (bOwnsVtxPointIndices) { PCGEX_DELETE(VtxPointIndices) }
-		if (bOwnsNodeOctree) { PCGEX_DELETE(NodeOctree) }
-		if (bOwnsEdgeOctree) { PCGEX_DELETE(EdgeOctree) }
+		if (bOwnsNodeKDTree) { PCGEX_DELETE(NodeKDTree) }
+		if (bOwnsEdgeBVH) { PCGEX_DELETE(EdgeBVH) }
+		if (bOwnsAdjacencyCSR) { PCGEX_DELETE(AdjacencyCSR) }
 		if (bOwnsExpandedNodes) { PCGEX_DELETE(ExpandedNodes) }
 		if (bOwnsExpandedEdges) { PCGEX_DELETE(ExpandedEdges) }
 
@@ -246,7 +313,7 @@ namespace PCGExCluster
 	bool FCluster::BuildFrom(
 		const PCGExData::FPointIO* EdgeIO,
 		const TArray<FPCGPoint>& InNodePoints,
-		const TMap<uint32, int32>& InEndpointsLookup,
+		const PCGEx::FIndexLookup& InEndpointsLookup,
 		const TArray<int32>* InExpectedAdjacency)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExCluster::BuildCluster);
@@ -326,6 +393,7 @@ namespace PCGExCluster
 
 		const TArray<FPCGPoint>& VtxPoints = SubGraph->VtxIO->GetOutIn()->GetPoints();
 		Nodes->Reserve(SubGraph->Nodes.Num());
+		NodeIndexLookup->Reserve(NumRawVtx);
 
 		Edges->Reserve(NumRawEdges);
 		Edges->Append(SubGraph->FlattenedEdges);
@@ -344,6 +412,103 @@ namespace PCGExCluster
 		Bounds = Bounds.ExpandBy(10);
 	}
 
+	void FCluster::BuildFrom(const FCluster* InSourceCluster, const PCGExGraph::FSubGraph* SubGraph)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExCluster::BuildClusterFromSourceCluster);
+
+		const PCGExGraph::FGraph* Graph = SubGraph->ParentGraph;
+		const TArray<FNode>& SourceNodes = *InSourceCluster->Nodes;
+		const TArray<PCGExGraph::FIndexedEdge>& SourceEdges = *InSourceCluster->Edges;
+
+		Bounds = FBox(ForceInit);
+
+		NumRawVtx = SubGraph->VtxIO->GetNum(PCGExData::ESource::Out);
+		NumRawEdges = SubGraph->Edges.Num();
+
+		// Graph nodes are indexed by source vtx point, and hold the compiled point index after Compile.
+		// Compiled edges are the valid source edges, in order.
+
+		TArray<int32> EdgeRemap;
+		PCGEX_SET_NUM_UNINITIALIZED(EdgeRemap, SourceEdges.Num())
+
+		Edges->Reserve(NumRawEdges);
+		for (int i = 0; i < SourceEdges.Num(); ++i)
+		{
+			const PCGExGraph::FIndexedEdge& E = SourceEdges[i];
+			if (!E.bValid)
+			{
+				EdgeRemap[i] = -1;
+				continue;
+			}
+
+			const int32 EdgeIndex = Edges->Num();
+			EdgeRemap[i] = EdgeIndex;
+			Edges->Emplace(EdgeIndex, Graph->Nodes[E.Start].PointIndex, Graph->Nodes[E.End].PointIndex, EdgeIndex);
+		}
+
+		check(Edges->Num() == NumRawEdges)
+
+		TArray<int32> NodeRemap;
+		PCGEX_SET_NUM_UNINITIALIZED(NodeRemap, SourceNodes.Num())
+
+		Nodes->Reserve(SourceNodes.Num());
+		NodePositions.Reserve(SourceNodes.Num());
+		NodeIndexLookup->Init(NumRawVtx);
+
+		for (int i = 0; i < SourceNodes.Num(); ++i)
+		{
+			const FNode& SourceNode = SourceNodes[i];
+			const PCGExGraph::FNode& GraphNode = Graph->Nodes[SourceNode.PointIndex];
+
+			if (!SourceNode.bValid || !GraphNode.bValid || GraphNode.Adjacency.IsEmpty())
+			{
+				NodeRemap[i] = -1;
+				continue;
+			}
+
+			const int32 NodeIndex = Nodes->Num();
+			NodeRemap[i] = NodeIndex;
+			Nodes->Emplace(NodeIndex, GraphNode.PointIndex);
+			NodeIndexLookup->Add(GraphNode.PointIndex, NodeIndex);
+
+			const FVector Pos = InSourceCluster->NodePositions[i];
+			NodePositions.Add(Pos);
+			Bounds += Pos;
+		}
+
+		for (int i = 0; i < SourceNodes.Num(); ++i)
+		{
+			if (NodeRemap[i] == -1) { continue; }
+
+			FNode& Node = *(Nodes->GetData() + NodeRemap[i]);
+			Node.Adjacency.Reserve(SourceNodes[i].Adjacency.Num());
+
+			for (const uint64 AdjacencyHash : SourceNodes[i].Adjacency)
+			{
+				uint32 OtherNodeIndex;
+				uint32 EdgeIndex;
+				PCGEx::H64(AdjacencyHash, OtherNodeIndex, EdgeIndex);
+
+				if (EdgeRemap[EdgeIndex] == -1 || NodeRemap[OtherNodeIndex] == -1) { continue; }
+				Node.Adjacency.Add(PCGEx::H64(NodeRemap[OtherNodeIndex], EdgeRemap[EdgeIndex]));
+			}
+		}
+
+		// Raw lengths don't depend on the rest of the cluster and carry over as-is
+		if (InSourceCluster->EdgeLengths && !InSourceCluster->bEdgeLengthsDirty && !InSourceCluster->bEdgeLengthsNormalized)
+		{
+			const TArray<double>& SourceLengths = *InSourceCluster->EdgeLengths;
+
+			EdgeLengths = new TArray<double>();
+			PCGEX_SET_NUM_UNINITIALIZED_PTR(EdgeLengths, NumRawEdges)
+			for (int i = 0; i < SourceEdges.Num(); ++i) { if (EdgeRemap[i] != -1) { (*EdgeLengths)[EdgeRemap[i]] = SourceLengths[i]; } }
+
+			bEdgeLengthsDirty = false;
+		}
+
+		Bounds = Bounds.ExpandBy(10);
+	}
+
 	bool FCluster::IsValidWith(const PCGExData::FPointIO* InVtxIO, const PCGExData::FPointIO* InEdgesIO) const
 	{
 		return NumRawVtx == InVtxIO->GetNum() && NumRawEdges == InEdgesIO->GetNum();
@@ -394,30 +559,23 @@ namespace PCGExCluster
 		return MakeArrayView(VtxPointScopes->GetData(), VtxPointScopes->Num());
 	}
 
-	void FCluster::RebuildNodeOctree()
+	void FCluster::RebuildNodeKDTree()
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(FCluster::RebuildNodeOctree);
+		TRACE_CPUPROFILER_EVENT_SCOPE(FCluster::RebuildNodeKDTree);
 
-		PCGEX_DELETE(NodeOctree)
-		const FPCGPoint* StartPtr = VtxIO->GetIn()->GetPoints().GetData();
-		NodeOctree = new ClusterItemOctree(Bounds.GetCenter(), (Bounds.GetExtent() + FVector(10)).Length());
-		for (int i = 0; i < Nodes->Num(); ++i)
-		{
-			const FNode* Node = Nodes->GetData() + i;
-			const FPCGPoint* Pt = StartPtr + Node->PointIndex;
-			NodeOctree->AddElement(FClusterItemRef(Node->NodeIndex, FBoxSphereBounds(Pt->GetLocalBounds().TransformBy(Pt->Transform))));
-		}
+		PCGEX_DELETE(NodeKDTree)
+		bOwnsNodeKDTree = true;
+
+		// Node positions are indexed by NodeIndex, so tree items are node indices
+		NodeKDTree = new PCGExGeo::FKDTree(NodePositions);
 	}
 
-	void FCluster::RebuildEdgeOctree()
+	void FCluster::RebuildEdgeBVH()
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(FCluster::RebuildEdgeOctree);
+		TRACE_CPUPROFILER_EVENT_SCOPE(FCluster::RebuildEdgeBVH);
 
-		check(Bounds.GetExtent().Length() != 0)
-
-		PCGEX_DELETE(EdgeOctree)
-
-		EdgeOctree = new ClusterItemOctree(Bounds.GetCenter(), (Bounds.GetExtent() + FVector(10)).Length());
+		PCGEX_DELETE(EdgeBVH)
+		bOwnsEdgeBVH = true;
 
 		if (!ExpandedEdges)
 		{
@@ -426,42 +584,42 @@ namespace PCGExCluster
 			PCGEX_SET_NUM_UNINITIALIZED_PTR(ExpandedEdges, Edges->Num());
 
 			TArray<FExpandedEdge*>& ExpandedEdgesRef = (*ExpandedEdges);
-
-			for (int i = 0; i < Edges->Num(); ++i)
-			{
-				FExpandedEdge* NewExpandedEdge = new FExpandedEdge(this, i);
-				ExpandedEdgesRef[i] = NewExpandedEdge;
-				EdgeOctree->AddElement(FClusterItemRef(i, NewExpandedEdge->Bounds));
-			}
-		}
-		else
-		{
-			for (int i = 0; i < Edges->Num(); ++i)
-			{
-				const FExpandedEdge* ExpandedEdge = *(ExpandedEdges->GetData() + i);
-				EdgeOctree->AddElement(
-						FClusterItemRef(i, ExpandedEdge->Bounds)
-					);
-			}
+			for (int i = 0; i < Edges->Num(); ++i) { ExpandedEdgesRef[i] = new FExpandedEdge(this, i); }
 		}
+
+		TArray<FBox> EdgeBounds;
+		PCGEX_SET_NUM_UNINITIALIZED(EdgeBounds, Edges->Num())
+		for (int i = 0; i < Edges->Num(); ++i) { EdgeBounds[i] = (*(ExpandedEdges->GetData() + i))->Bounds.GetBox(); }
+
+		EdgeBVH = new PCGExGeo::FBVH(EdgeBounds);
 	}
 
-	void FCluster::RebuildOctree(const EPCGExClusterClosestSearchMode Mode, const bool bForceRebuild)
+	void FCluster::RebuildSpatialIndex(const EPCGExClusterClosestSearchMode Mode, const bool bForceRebuild)
 	{
 		switch (Mode)
 		{
 		case EPCGExClusterClosestSearchMode::Node:
-			if (NodeOctree && !bForceRebuild) { return; }
-			RebuildNodeOctree();
+			if (NodeKDTree && !bForceRebuild) { return; }
+			RebuildNodeKDTree();
 			break;
 		case EPCGExClusterClosestSearchMode::Edge:
-			if (EdgeOctree && !bForceRebuild) { return; }
-			RebuildEdgeOctree();
+			if (EdgeBVH && !bForceRebuild) { return; }
+			RebuildEdgeBVH();
 			break;
 		default: ;
 		}
 	}
 
+	void FCluster::RebuildAdjacencyCSR(const bool bForceRebuild)
+	{
+		if (AdjacencyCSR && !bForceRebuild) { return; }
+
+		if (bOwnsAdjacencyCSR) { PCGEX_DELETE(AdjacencyCSR) }
+		bOwnsAdjacencyCSR = true;
+
+		AdjacencyCSR = new FAdjacencyCSR(this);
+	}
+
 	int32 FCluster::FindClosestNode(const FVector& Position, const EPCGExClusterClosestSearchMode Mode, const int32 MinNeighbors) const
 	{
 		switch (Mode)
@@ -476,38 +634,31 @@ namespace PCGExCluster
 
 	int32 FCluster::FindClosestNode(const FVector& Position, const int32 MinNeighbors) const
 	{
-		double MaxDistance = TNumericLimits<double>::Max();
-		int32 ClosestIndex = -1;
-
 		const TArray<FNode>& NodesRef = *Nodes;
 
-		if (NodeOctree)
+		if (NodeKDTree)
 		{
-			auto ProcessCandidate = [&](const FClusterItemRef& Item)
-			{
-				const FNode& Node = NodesRef[Item.ItemIndex];
-				if (Node.Adjacency.Num() < MinNeighbors) { return; }
-				const double Dist = FVector::DistSquared(Position, GetPos(Node));
-				if (Dist < MaxDistance)
+			double DistSquared = 0;
+			return NodeKDTree->FindNearest(
+				Position, [&](const int32 NodeIndex)
 				{
-					MaxDistance = Dist;
-					ClosestIndex = Node.NodeIndex;
-				}
-			};
-
-			NodeOctree->FindNearbyElements(Position, ProcessCandidate);
+					const FNode& Node = NodesRef[NodeIndex];
+					return Node.bValid && Node.Adjacency.Num() >= MinNeighbors;
+				},
+				DistSquared);
 		}
-		else
+
+		double MaxDistance = TNumericLimits<double>::Max();
+		int32 ClosestIndex = -1;
+
+		for (const FNode& Node : NodesRef)
 		{
-			for (const FNode& Node : (*Nodes))
+			if (!Node.bValid || Node.Adjacency.Num() < MinNeighbors) { continue; }
+			const double Dist = FVector::DistSquared(Position, GetPos(Node));
+			if (Dist < MaxDistance)
 			{
-				if (Node.Adjacency.Num() < MinNeighbors) { continue; }
-				const double Dist = FVector::DistSquared(Position, GetPos(Node));
-				if (Dist < MaxDistance)
-				{
-					MaxDistance = Dist;
-					ClosestIndex = Node.NodeIndex;
-				}
+				MaxDistance = Dist;
+				ClosestIndex = Node.NodeIndex;
 			}
 		}
 
@@ -516,64 +667,102 @@ namespace PCGExCluster
 
 	int32 FCluster::FindClosestNodeFromEdge(const FVector& Position, const int32 MinNeighbors) const
 	{
-		double MaxDistance = TNumericLimits<double>::Max();
-		int32 ClosestIndex = -1;
+		double DistSquared = 0;
+		const int32 ClosestIndex = FindClosestEdge(Position, DistSquared);
+
+		if (ClosestIndex == -1) { return -1; }
+
+		const TArray<FNode>& NodesRef = *Nodes;
+		const PCGExGraph::FIndexedEdge& Edge = *(Edges->GetData() + ClosestIndex);
+		const FNode& Start = NodesRef[(*NodeIndexLookup)[Edge.Start]];
+		const FNode& End = NodesRef[(*NodeIndexLookup)[Edge.End]];
+
+		return FVector::DistSquared(Position, GetPos(Start)) < FVector::DistSquared(Position, GetPos(End)) ? Start.NodeIndex : End.NodeIndex;
+	}
 
+	int32 FCluster::FindClosestEdge(const FVector& Position, double& OutDistSquared) const
+	{
 		const TArray<FNode>& NodesRef = *Nodes;
 		const TArray<PCGExGraph::FIndexedEdge>& EdgesRef = *Edges;
-		const TMap<int32, int32>& NodeIndexLookupRef = *NodeIndexLookup;
+		const PCGEx::FIndexLookup& NodeIndexLookupRef = *NodeIndexLookup;
 
-		if (EdgeOctree)
+		auto EdgeDistSquared = [&](const int32 EdgeIndex)
 		{
-			auto ProcessCandidate = [&](const FClusterItemRef& Item)
+			if (!EdgesRef[EdgeIndex].bValid) { return TNumericLimits<double>::Max(); } // Removed in-place
+
+			if (ExpandedEdges)
 			{
-				const FExpandedEdge* Edge = *(ExpandedEdges->GetData() + Item.ItemIndex);
-				const double Dist = FMath::PointDistToSegmentSquared(Position, GetPos(Edge->Start), GetPos(Edge->End));
-				if (Dist < MaxDistance)
-				{
-					MaxDistance = Dist;
-					ClosestIndex = Edge->Index;
-				}
-			};
+				const FExpandedEdge* Edge = *(ExpandedEdges->GetData() + EdgeIndex);
+				return FMath::PointDistToSegmentSquared(Position, GetPos(Edge->Start), GetPos(Edge->End));
+			}
 
-			EdgeOctree->FindNearbyElements(Position, ProcessCandidate);
+			const PCGExGraph::FIndexedEdge& Edge = EdgesRef[EdgeIndex];
+			return FMath::PointDistToSegmentSquared(Position, GetPos(NodeIndexLookupRef[Edge.Start]), GetPos(NodeIndexLookupRef[Edge.End]));
+		};
+
+		OutDistSquared = TNumericLimits<double>::Max();
+		int32 ClosestIndex = -1;
+		int32 NumIndexed = 0;
+
+		if (EdgeBVH)
+		{
+			ClosestIndex = EdgeBVH->FindNearest(Position, EdgeDistSquared, OutDistSquared);
+			NumIndexed = EdgeBVH->Num();
 		}
-		else if (ExpandedEdges)
+
+		// Edges added after the BVH was built aren't indexed
+		for (int i = NumIndexed; i < EdgesRef.Num(); ++i)
 		{
-			for (const FExpandedEdge* Edge : (*ExpandedEdges))
+			const double Dist = EdgeDistSquared(i);
+			if (Dist < OutDistSquared)
 			{
-				const double Dist = FMath::PointDistToSegmentSquared(Position, GetPos(Edge->Start), GetPos(Edge->End));
-				if (Dist < MaxDistance)
-				{
-					MaxDistance = Dist;
-					ClosestIndex = Edge->Index;
-				}
+				OutDistSquared = Dist;
+				ClosestIndex = i;
 			}
 		}
-		else
+
+		return ClosestIndex;
+	}
+
+	void FCluster::FindKClosestNodes(const FVector& Position, const int32 K, TArray<int32>& OutNodeIndices, const int32 MinNeighbors) const
+	{
+		const TArray<FNode>& NodesRef = *Nodes;
+		auto IsValidNode = [&](const int32 NodeIndex) { return NodesRef[NodeIndex].bValid && NodesRef[NodeIndex].Adjacency.Num() >= MinNeighbors; };
+
+		if (NodeKDTree)
 		{
-			for (const PCGExGraph::FIndexedEdge& Edge : (*Edges))
-			{
-				const FNode& Start = NodesRef[NodeIndexLookupRef[Edge.Start]];
-				const FNode& End = NodesRef[NodeIndexLookupRef[Edge.End]];
-				const double Dist = FMath::PointDistToSegmentSquared(Position, GetPos(Start), GetPos(End));
-				if (Dist < MaxDistance)
-				{
-					MaxDistance = Dist;
-					ClosestIndex = Edge.EdgeIndex;
-				}
-			}
+			NodeKDTree->FindKNearest(Position, K, OutNodeIndices, IsValidNode);
+			return;
 		}
 
-		if (ClosestIndex == -1) { return -1; }
+		OutNodeIndices.Reset();
+		for (int i = 0; i < NodesRef.Num(); ++i) { if (IsValidNode(i)) { OutNodeIndices.Add(i); } }
 
-		const PCGExGraph::FIndexedEdge& Edge = EdgesRef[ClosestIndex];
-		const FNode& Start = NodesRef[NodeIndexLookupRef[Edge.Start]];
-		const FNode& End = NodesRef[NodeIndexLookupRef[Edge.End]];
+		Algo::SortBy(OutNodeIndices, [&](const int32 NodeIndex) { return FVector::DistSquared(Position, GetPos(NodeIndex)); });
+		if (OutNodeIndices.Num() > K) { OutNodeIndices.SetNum(FMath::Max(0, K)); }
+	}
 
-		ClosestIndex = FVector::DistSquared(Position, GetPos(Start)) < FVector::DistSquared(Position, GetPos(End)) ? Start.NodeIndex : End.NodeIndex;
+	void FCluster::FindNodesInRadius(const FVector& Position, const double Radius, TArray<int32>& OutNodeIndices, const int32 MinNeighbors) const
+	{
+		const TArray<FNode>& NodesRef = *Nodes;
+		OutNodeIndices.Reset();
 
-		return ClosestIndex;
+		if (NodeKDTree)
+		{
+			NodeKDTree->FindInRadius(
+				Position, Radius, [&](const int32 NodeIndex, const double)
+				{
+					if (NodesRef[NodeIndex].bValid && NodesRef[NodeIndex].Adjacency.Num() >= MinNeighbors) { OutNodeIndices.Add(NodeIndex); }
+				});
+			return;
+		}
+
+		const double RadiusSquared = Radius * Radius;
+		for (const FNode& Node : NodesRef)
+		{
+			if (!Node.bValid || Node.Adjacency.Num() < MinNeighbors) { continue; }
+			if (FVector::DistSquared(Position, GetPos(Node)) <= RadiusSquared) { OutNodeIndices.Add(Node.NodeIndex); }
+		}
 	}
 
 	int32 FCluster::FindClosestEdge(const int32 InNodeIndex, const FVector& InPosition) const
@@ -648,32 +837,15 @@ namespace PCGExCluster
 		double LastDist = TNumericLimits<double>::Max();
 		const FVector NodePosition = GetPos(NodeIndex);
 
-		if (NodeOctree)
-		{
-			auto ProcessCandidate = [&](const FClusterItemRef& Item)
-			{
-				if (NodesRef[Item.ItemIndex].Adjacency.Num() < MinNeighborCount) { return; }
-				if (const double Dist = FMath::PointDistToSegmentSquared(Position, NodePosition, GetPos(Item.ItemIndex));
-					Dist < LastDist)
-				{
-					LastDist = Dist;
-					Result = Item.ItemIndex;
-				}
-			};
-
-			NodeOctree->FindNearbyElements(Position, ProcessCandidate);
-		}
-		else
+		for (const uint64 AdjacencyHash : Node.Adjacency)
 		{
-			for (const int32 OtherIndex : Node.Adjacency)
+			const int32 OtherIndex = PCGEx::H64A(AdjacencyHash);
+			if (NodesRef[OtherIndex].Adjacency.Num() < MinNeighborCount) { continue; }
+			if (const double Dist = FMath::PointDistToSegmentSquared(Position, NodePosition, GetPos(OtherIndex));
+				Dist < LastDist)
 			{
-				if (NodesRef[OtherIndex].Adjacency.Num() < MinNeighborCount) { continue; }
-				if (const double Dist = FMath::PointDistToSegmentSquared(Position, NodePosition, GetPos(OtherIndex));
-					Dist < LastDist)
-				{
-					LastDist = Dist;
-					Result = OtherIndex;
-				}
+				LastDist = Dist;
+				Result = OtherIndex;
 			}
 		}
 
@@ -688,34 +860,16 @@ namespace PCGExCluster
 		double LastDist = TNumericLimits<double>::Max();
 		const FVector NodePosition = GetPos(NodeIndex);
 
-		if (NodeOctree)
-		{
-			auto ProcessCandidate = [&](const FClusterItemRef& Item)
-			{
-				if (NodesRef[Item.ItemIndex].Adjacency.Num() < MinNeighborCount) { return; }
-				if (Exclusion.Contains(Item.ItemIndex)) { return; }
-				if (const double Dist = FMath::PointDistToSegmentSquared(Position, NodePosition, GetPos(Item.ItemIndex));
-					Dist < LastDist)
-				{
-					LastDist = Dist;
-					Result = Item.ItemIndex;
-				}
-			};
-
-			NodeOctree->FindNearbyElements(Position, ProcessCandidate);
-		}
-		else
+		for (const uint64 AdjacencyHash : Node.Adjacency)
 		{
-			for (const int32 OtherIndex : Node.Adjacency)
+			const int32 OtherIndex = PCGEx::H64A(AdjacencyHash);
+			if (NodesRef[OtherIndex].Adjacency.Num() < MinNeighborCount) { continue; }
+			if (Exclusion.Contains(OtherIndex)) { continue; }
+			if (const double Dist = FMath::PointDistToSegmentSquared(Position, NodePosition, GetPos(OtherIndex));
+				Dist < LastDist)
 			{
-				if (NodesRef[OtherIndex].Adjacency.Num() < MinNeighborCount) { continue; }
-				if (Exclusion.Contains(OtherIndex)) { continue; }
-				if (const double Dist = FMath::PointDistToSegmentSquared(Position, NodePosition, GetPos(OtherIndex));
-					Dist < LastDist)
-				{
-					LastDist = Dist;
-					Result = OtherIndex;
-				}
+				LastDist = Dist;
+				Result = OtherIndex;
 			}
 		}
 
@@ -731,7 +885,7 @@ namespace PCGExCluster
 
 		const TArray<FNode>& NodesRef = *Nodes;
 		const TArray<PCGExGraph::FIndexedEdge>& EdgesRef = *Edges;
-		const TMap<int32, int32>& NodeIndexLookupRef = *NodeIndexLookup;
+		const PCGEx::FIndexLookup& NodeIndexLookupRef = *NodeIndexLookup;
 
 		const int32 NumEdges = Edges->Num();
 		double Min = TNumericLimits<double>::Max();
@@ -751,6 +905,208 @@ namespace PCGExCluster
 		if (bNormalize) { for (int i = 0; i < NumEdges; ++i) { LengthsRef[i] = PCGExMath::Remap(LengthsRef[i], 0, Max, 0, 1); } }
 
 		bEdgeLengthsDirty = false;
+		bEdgeLengthsNormalized = bNormalize;
+	}
+
+	void FCluster::WillModifyTopology()
+	{
+		if (!bOwnsNodes)
+		{
+			Nodes = new TArray<FNode>(*Nodes);
+			bOwnsNodes = true;
+		}
+
+		if (!bOwnsEdges)
+		{
+			Edges = new TArray<PCGExGraph::FIndexedEdge>(*Edges);
+			bOwnsEdges = true;
+		}
+
+		if (EdgeLengths && !bOwnsLengths)
+		{
+			EdgeLengths = new TArray<double>(*EdgeLengths);
+			bOwnsLengths = true;
+		}
+
+		// Expanded nodes cache neighbors & edge pointers, they can't be patched
+		if (!bOwnsExpandedNodes)
+		{
+			ExpandedNodes = nullptr;
+			bOwnsExpandedNodes = true;
+		}
+		else { PCGEX_DELETE_TARRAY_FULL(ExpandedNodes) }
+
+		// Expanded edges only point to nodes, so owned ones stay valid and get appended to
+		if (!bOwnsExpandedEdges)
+		{
+			ExpandedEdges = nullptr;
+			bOwnsExpandedEdges = true;
+		}
+
+		// Node adjacency is the source of truth while editing; callers can RebuildAdjacencyCSR once done
+		if (bOwnsAdjacencyCSR) { PCGEX_DELETE(AdjacencyCSR) }
+		AdjacencyCSR = nullptr;
+		bOwnsAdjacencyCSR = true;
+
+		// The node KD-tree & edge BVH are left as-is : removed items are filtered out at query time,
+		// and edges appended past the BVH are scanned linearly.
+	}
+
+	void FCluster::RemoveEdges(const TArrayView<const int32> InEdgeIndices)
+	{
+		WillModifyTopology();
+
+		TArray<FNode>& NodesRef = *Nodes;
+		const PCGEx::FIndexLookup& NodeIndexLookupRef = *NodeIndexLookup;
+
+		for (const int32 EdgeIndex : InEdgeIndices)
+		{
+			PCGExGraph::FIndexedEdge& Edge = *(Edges->GetData() + EdgeIndex);
+			Edge.bValid = false;
+
+			const int32 StartNodeIndex = NodeIndexLookupRef[Edge.Start];
+			const int32 EndNodeIndex = NodeIndexLookupRef[Edge.End];
+
+			NodesRef[StartNodeIndex].Adjacency.RemoveSingle(PCGEx::H64(EndNodeIndex, EdgeIndex));
+			NodesRef[EndNodeIndex].Adjacency.RemoveSingle(PCGEx::H64(StartNodeIndex, EdgeIndex));
+		}
+	}
+
+	void FCluster::RemoveNodes(const TArrayView<const int32> InNodeIndices)
+	{
+		WillModifyTopology();
+
+		TArray<FNode>& NodesRef = *Nodes;
+
+		for (const int32 NodeIndex : InNodeIndices)
+		{
+			FNode& Node = NodesRef[NodeIndex];
+			Node.bValid = false;
+
+			for (const uint64 AdjacencyHash : Node.Adjacency)
+			{
+				uint32 OtherNodeIndex;
+				uint32 EdgeIndex;
+				PCGEx::H64(AdjacencyHash, OtherNodeIndex, EdgeIndex);
+
+				(Edges->GetData() + EdgeIndex)->bValid = false;
+				NodesRef[OtherNodeIndex].Adjacency.RemoveSingle(PCGEx::H64(NodeIndex, EdgeIndex));
+			}
+
+			Node.Adjacency.Empty();
+		}
+	}
+
+	int32 FCluster::AddEdge(const int32 NodeA, const int32 NodeB)
+	{
+		if (NodeA == NodeB) { return -1; }
+
+		{
+			const FNode& A = *(Nodes->GetData() + NodeA);
+			const FNode& B = *(Nodes->GetData() + NodeB);
+			if (!A.bValid || !B.bValid || A.IsAdjacentTo(NodeB)) { return -1; }
+		}
+
+		WillModifyTopology();
+
+		FNode& A = *(Nodes->GetData() + NodeA);
+		FNode& B = *(Nodes->GetData() + NodeB);
+
+		const int32 EdgeIndex = Edges->Emplace(Edges->Num(), A.PointIndex, B.PointIndex, -1, EdgesIO ? EdgesIO->IOIndex : -1);
+
+		A.Add(B, EdgeIndex);
+		B.Add(A, EdgeIndex);
+
+		if (ExpandedEdges) { ExpandedEdges->Add(new FExpandedEdge(this, EdgeIndex)); }
+
+		if (EdgeLengths)
+		{
+			if (bEdgeLengthsNormalized)
+			{
+				// Normalization depends on the longest edge, recompute on demand
+				PCGEX_DELETE(EdgeLengths)
+				bEdgeLengthsDirty = true;
+			}
+			else
+			{
+				EdgeLengths->Add(GetDistSquared(NodeA, NodeB));
+			}
+		}
+
+		return EdgeIndex;
+	}
+
+	int32 FCluster::RemoveInvalidEdges()
+	{
+		WillModifyTopology();
+
+		TArray<FNode>& NodesRef = *Nodes;
+		TArray<PCGExGraph::FIndexedEdge>& EdgesRef = *Edges;
+		const PCGEx::FIndexLookup& NodeIndexLookupRef = *NodeIndexLookup;
+
+		int32 NumValidEdges = 0;
+		for (PCGExGraph::FIndexedEdge& Edge : EdgesRef)
+		{
+			if (Edge.bValid && (!NodesRef[NodeIndexLookupRef[Edge.Start]].bValid || !NodesRef[NodeIndexLookupRef[Edge.End]].bValid)) { Edge.bValid = false; }
+			if (Edge.bValid) { NumValidEdges++; }
+		}
+
+		for (FNode& Node : NodesRef)
+		{
+			Node.Adjacency.RemoveAll([&](const uint64 AdjacencyHash) { return !EdgesRef[PCGEx::H64B(AdjacencyHash)].bValid; });
+		}
+
+		return NumValidEdges;
+	}
+
+	bool FCluster::IsConnected() const
+	{
+		const TArray<FNode>& NodesRef = *Nodes;
+		const TArray<PCGExGraph::FIndexedEdge>& EdgesRef = *Edges;
+
+		int32 Seed = -1;
+		int32 NumLinkedNodes = 0;
+
+		for (const FNode& Node : NodesRef)
+		{
+			if (!Node.bValid || Node.Adjacency.IsEmpty()) { continue; }
+			if (Seed == -1) { Seed = Node.NodeIndex; }
+			NumLinkedNodes++;
+		}
+
+		if (Seed == -1) { return false; }
+
+		TBitArray<> Visited;
+		Visited.Init(false, NodesRef.Num());
+		Visited[Seed] = true;
+
+		TArray<int32> Stack;
+		Stack.Add(Seed);
+		int32 NumVisited = 1;
+
+		while (!Stack.IsEmpty())
+		{
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION <= 3
+			const int32 Current = Stack.Pop(false);
+#else
+			const int32 Current = Stack.Pop(EAllowShrinking::No);
+#endif
+
+			for (const uint64 AdjacencyHash : NodesRef[Current].Adjacency)
+			{
+				uint32 OtherNodeIndex;
+				uint32 EdgeIndex;
+				PCGEx::H64(AdjacencyHash, OtherNodeIndex, EdgeIndex);
+
+				if (Visited[OtherNodeIndex] || !EdgesRef[EdgeIndex].bValid || !NodesRef[OtherNodeIndex].bValid) { continue; }
+
+				Visited[OtherNodeIndex] = true;
+				Stack.Add(OtherNodeIndex);
+				NumVisited++;
+			}
+		}
+
+		return NumVisited == NumLinkedNodes;
 	}
 
 	void FCluster::GetConnectedNodes(const int32 FromIndex, TArray<int32>& OutIndices, const int32 SearchDepth) const
@@ -827,7 +1183,7 @@ namespace PCGExCluster
 
 	void FCluster::GetValidEdges(TArray<PCGExGraph::FIndexedEdge>& OutValidEdges) const
 	{
-		TMap<int32, int32>& LookupRef = (*NodeIndexLookup);
+		const PCGEx::FIndexLookup& LookupRef = (*NodeIndexLookup);
 		for (const PCGExGraph::FIndexedEdge& Edge : (*Edges))
 		{
 			if (!Edge.bValid ||
@@ -1007,7 +1363,7 @@ namespace PCGExClusterTask
 
 			if (!bIsValidStartNode) { continue; }
 
-			for (const uint64 AdjacencyHash : Node.Adjacency)
+			for (const uint64 AdjacencyHash : Cluster->GetAdjacency(Node.NodeIndex))
 			{
 				uint32 OtherNodeIndex;
 				uint32 EdgeIndex;
@@ -66,6 +66,8 @@ namespace PCGExGraph
 		CompoundGraph = InCompoundGraph;
 		CompoundFacade = InCompoundFacade;
 
+		CompoundGraph->Finalize();
+
 		const int32 NumCompoundNodes = CompoundGraph->Nodes.Num();
 		if (NumCompoundNodes == 0)
 		{
@@ -3,6 +3,7 @@
 
 #include "Graph/PCGExConnectPoints.h"
 
+#include "Data/PCGExSpatialIndexCache.h"
 #include "Graph/PCGExGraph.h"
 #include "Graph/Data/PCGExClusterData.h"
 #include "Graph/PCGExCompoundHelpers.h"
@@ -123,6 +124,8 @@ namespace PCGExConnectPoints
 		CanGenerate.Empty();
 
 		PCGEX_DELETE(Octree)
+		if (bSharedGrid) { PCGExData::FSpatialIndexCache::Get().Release(Grid); }
+		else { PCGEX_DELETE(Grid) }
 	}
 
 	bool FProcessor::Process(PCGExMT::FTaskManager* AsyncManager)
@@ -199,12 +202,7 @@ namespace PCGExConnectPoints
 
 		InPoints = &PointIO->GetIn()->GetPoints();
 
-		if (!ProbeOperations.IsEmpty())
-		{
-			const FBox B = PointIO->GetIn()->GetBounds();
-			Octree = new PositionOctree(bUseProjection ? ProjectionDetails.ProjectFlat(B.GetCenter()) : B.GetCenter(), B.GetExtent().Length());
-		}
-		else
+		if (ProbeOperations.IsEmpty())
 		{
 			if (GeneratorsFilter) { for (int i = 0; i < InPoints->Num(); ++i) { CanGenerate[i] = GeneratorsFilter->Test(i); } }
 		}
@@ -229,30 +227,71 @@ namespace PCGExConnectPoints
 
 		if (!ProbeOperations.IsEmpty())
 		{
-			constexpr double PPRefRadius = 0.05;
-			const FVector PPRefExtents = FVector(PPRefRadius);
+			TArray<FVector> Positions;
+			PCGEX_SET_NUM_UNINITIALIZED(Positions, NumPoints)
+
+			TArray<int32> Connectables;
+			Connectables.Reserve(NumPoints);
 
-			if (bUseProjection)
+			FBox PositionBounds(ForceInit);
+
+			for (int i = 0; i < NumPoints; ++i)
 			{
+				CachedTransforms[i] = bUseProjection ? ProjectionDetails.ProjectFlat(InPointsRef[i].Transform, i) : InPointsRef[i].Transform;
+				Positions[i] = CachedTransforms[i].GetLocation();
+
+				CanGenerate[i] = GeneratorsFilter ? GeneratorsFilter->Test(i) : true;
+				if (ConnectableFilter && !ConnectableFilter->Test(i)) { continue; }
+
+				Connectables.Add(i);
+				PositionBounds += Positions[i];
+			}
+
+			// Pick the index from the radius distribution :
+			// a hash grid sized to the largest radius when radii are uniform enough, the octree otherwise.
+			double GridCellSize = SharedSearchRadius;
+			bool bUseGrid = true;
+
+			if (bUseVariableRadius)
+			{
+				double MaxRadius = 0;
+				double SumRadius = 0;
+				int32 NumGenerators = 0;
+
 				for (int i = 0; i < NumPoints; ++i)
 				{
-					CachedTransforms[i] = ProjectionDetails.ProjectFlat(InPointsRef[i].Transform, i);
+					if (!CanGenerate[i]) { continue; }
+					const double Radius = GetSearchRadius(i);
+					MaxRadius = FMath::Max(MaxRadius, Radius);
+					SumRadius += Radius;
+					NumGenerators++;
+				}
+
+				GridCellSize = MaxRadius;
+				bUseGrid = NumGenerators > 0 && MaxRadius <= GridMaxRadiusSpread * (SumRadius / NumGenerators);
+			}
 
-					CanGenerate[i] = GeneratorsFilter ? GeneratorsFilter->Test(i) : true;
-					if (ConnectableFilter && ConnectableFilter->Test(i)) { continue; }
-					Octree->AddElement(FPositionRef(i, FBoxSphereBounds(CachedTransforms[i].GetLocation(), PPRefExtents, PPRefRadius)));
+			if (bUseGrid && PCGExGeo::FPointHashGrid::CanIndex(PositionBounds, GridCellSize))
+			{
+				bSharedGrid = !bUseProjection && Connectables.Num() == NumPoints;
+				if (bSharedGrid)
+				{
+					// Unprojected, unfiltered positions : the grid only depends on the input data & cell size
+					Grid = PCGExData::FSpatialIndexCache::Get().AcquireGrid(PointIO->GetIn(), GridCellSize);
+				}
+				else
+				{
+					Grid = new PCGExGeo::FPointHashGrid(GridCellSize, Positions, Connectables);
 				}
 			}
 			else
 			{
-				for (int i = 0; i < NumPoints; ++i)
-				{
-					CachedTransforms[i] = InPointsRef[i].Transform;
+				constexpr double PPRefRadius = 0.05;
+				const FVector PPRefExtents = FVector(PPRefRadius);
 
-					CanGenerate[i] = GeneratorsFilter ? GeneratorsFilter->Test(i) : true;
-					if (ConnectableFilter && !ConnectableFilter->Test(i)) { continue; }
-					Octree->AddElement(FPositionRef(i, FBoxSphereBounds(CachedTransforms[i].GetLocation(), PPRefExtents, PPRefRadius)));
-				}
+				const FBox B = PointIO->GetIn()->GetBounds();
+				Octree = new PositionOctree(bUseProjection ? ProjectionDetails.ProjectFlat(B.GetCenter()) : B.GetCenter(), B.GetExtent().Length());
+				for (const int32 i : Connectables) { Octree->AddElement(FPositionRef(i, FBoxSphereBounds(Positions[i], PPRefExtents, PPRefRadius))); }
 			}
 		}
 
@@ -263,6 +302,15 @@ namespace PCGExConnectPoints
 		StartParallelLoopForPoints(PCGExData::ESource::In);
 	}
 
+	double FProcessor::GetSearchRadius(const int32 Index) const
+	{
+		if (!bUseVariableRadius) { return SharedSearchRadius; }
+
+		double MaxRadius = TNumericLimits<double>::Min();
+		for (const UPCGExProbeOperation* Op : ProbeOperations) { MaxRadius = FMath::Max(MaxRadius, Op->SearchRadiusCache ? Op->SearchRadiusCache->Values[Index] : Op->SearchRadius); }
+		return MaxRadius;
+	}
+
 	void FProcessor::PrepareLoopScopesForPoints(const TArray<uint64>& Loops)
 	{
 		PCGEX_TYPED_CONTEXT_AND_SETTINGS(ConnectPoints)
@@ -271,7 +319,7 @@ namespace PCGExConnectPoints
 		for (int i = 0; i < Loops.Num(); ++i) { DistributedEdgesSet.Add(new TSet<uint64>()); }
 	}
 
-	void FProcessor::ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const int32 LoopIdx, const int32 Count)
+	void FProcessor::ProcessSingleInPoint(const int32 Index, const FPCGPoint& Point, const int32 LoopIdx, const int32 Count)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExConnectPointsElement::ProcessSinglePoint);
 
@@ -299,20 +347,13 @@ namespace PCGExConnectPoints
 
 		if (!ProbeOperations.IsEmpty())
 		{
-			double MaxRadius = TNumericLimits<double>::Min();
-			if (!bUseVariableRadius) { MaxRadius = SharedSearchRadius; }
-			else
-			{
-				for (UPCGExProbeOperation* Op : ProbeOperations) { MaxRadius = FMath::Max(MaxRadius, Op->SearchRadiusCache ? Op->SearchRadiusCache->Values[Index] : Op->SearchRadius); }
-			}
-
+			const double MaxRadius = GetSearchRadius(Index);
 			const FVector Origin = CachedTransforms[Index].GetLocation();
 
 			TArray<PCGExProbing::FCandidate> Candidates;
 
-			auto ProcessPoint = [&](const FPositionRef& InPositionRef)
+			auto ProcessPoint = [&](const int32 OtherPointIndex)
 			{
-				const int32 OtherPointIndex = InPositionRef.Index;
 				if (OtherPointIndex == Index) { return; }
 
 				const FVector Position = CachedTransforms[OtherPointIndex].GetLocation();
@@ -326,7 +367,8 @@ namespace PCGExConnectPoints
 				if (NumChainedOps > 0) { for (int i = 0; i < NumChainedOps; ++i) { ChainProbeOperations[i]->ProcessCandidateChained(i, PointCopy, EmplaceIndex, Candidates[EmplaceIndex], BestCandidates[i]); } }
 			};
 
-			Octree->FindElementsWithBoundsTest(FBoxCenterAndExtent(Origin, FVector(MaxRadius)), ProcessPoint);
+			if (Grid) { Grid->FindInBox(FBox(Origin - FVector(MaxRadius), Origin + FVector(MaxRadius)), ProcessPoint); }
+			else { Octree->FindElementsWithBoundsTest(FBoxCenterAndExtent(Origin, FVector(MaxRadius)), [&](const FPositionRef& InPositionRef) { ProcessPoint(InPositionRef.Index); }); }
 
 			if (NumChainedOps > 0) { for (int i = 0; i < NumChainedOps; ++i) { ChainProbeOperations[i]->ProcessBestCandidate(Index, PointCopy, BestCandidates[i], Candidates, LocalCoincidence, CWCoincidenceTolerance, UniqueEdges); } }
 
@@ -37,7 +37,10 @@ namespace PCGExGraph
 		NewCluster->VtxIO = VtxIO;
 		NewCluster->EdgesIO = EdgesIO;
 
-		NewCluster->BuildFrom(this);
+		// An in-place edited cluster only needs remapping to the compiled points
+		if (SourceCluster) { NewCluster->BuildFrom(SourceCluster, this); }
+		else { NewCluster->BuildFrom(this); }
+
 		// Look into the cost of this
 		if (AsyncManager) { NewCluster->ExpandEdges(AsyncManager); }
 		else { NewCluster->GetExpandedEdges(true); }
@@ -47,8 +50,7 @@ namespace PCGExGraph
 
 	int32 FSubGraph::GetFirstInIOIndex()
 	{
-		for (const int32 InIOIndex : EdgesInIOIndices) { return InIOIndex; }
-		return -1;
+		return FirstInIOIndex;
 	}
 
 	void FGraph::ReserveForEdges(const int32 UpcomingAdditionCount)
@@ -176,71 +178,218 @@ namespace PCGExGraph
 	}
 
 
+	// Lock-free union-find over a shared parent array.
+	// Roots are always linked under the smaller index, so a component's root is its lowest node index.
+
+	static int32 UFFind(int32* Parent, int32 Index)
+	{
+		while (true)
+		{
+			const int32 P = FPlatformAtomics::AtomicRead(Parent + Index);
+			if (P == Index) { return Index; }
+
+			const int32 GP = FPlatformAtomics::AtomicRead(Parent + P);
+			if (GP != P) { FPlatformAtomics::InterlockedCompareExchange(Parent + Index, GP, P); } // Path halving
+
+			Index = P;
+		}
+	}
+
+	static void UFUnion(int32* Parent, int32 A, int32 B)
+	{
+		while (true)
+		{
+			A = UFFind(Parent, A);
+			B = UFFind(Parent, B);
+
+			if (A == B) { return; }
+			if (A > B) { Swap(A, B); }
+
+			// Link B under A only if B is still a root; otherwise someone linked it first, retry from the new roots
+			if (FPlatformAtomics::InterlockedCompareExchange(Parent + B, A, B) == B) { return; }
+		}
+	}
+
 	void FGraph::BuildSubGraphs(const FPCGExGraphBuilderDetails& Limits)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::BuildSubGraphs);
 
-		TBitArray<> VisitedNodes;
-		TBitArray<> VisitedEdges;
-		VisitedNodes.Init(false, Nodes.Num());
-		VisitedEdges.Init(false, Edges.Num());
+		PrepareComponents();
+		UnionComponents(0, Edges.Num());
+		FlattenComponents(0, Nodes.Num());
+		BucketSubGraphs(Limits);
+	}
+
+	void FGraph::BuildSubGraphs(PCGExMT::FTaskManager* AsyncManager, const FPCGExGraphBuilderDetails& Limits, PCGExMT::FTaskGroup::CompletionCallback&& OnComplete)
+	{
+		if (Edges.Num() < GetDefault<UPCGExGlobalSettings>()->SmallClusterSize)
+		{
+			BuildSubGraphs(Limits);
+			OnComplete();
+			return;
+		}
+
+		PrepareComponents();
+
+		const int32 ChunkSize = GetDefault<UPCGExGlobalSettings>()->GetClusterBatchChunkSize();
+
+		PCGEX_ASYNC_GROUP(AsyncManager, UnionComponentsTask)
+		UnionComponentsTask->SetOnCompleteCallback(
+			[this, AsyncManager, &Limits, ChunkSize, OnComplete]()
+			{
+				PCGEX_ASYNC_GROUP(AsyncManager, FlattenComponentsTask)
+				FlattenComponentsTask->SetOnCompleteCallback(
+					[this, &Limits, OnComplete]()
+					{
+						BucketSubGraphs(Limits);
+						OnComplete();
+					});
+
+				FlattenComponentsTask->SetOnIterationRangeStartCallback(
+					[this](const int32 StartIndex, const int32 Count, const int32 LoopIdx) { FlattenComponents(StartIndex, Count); });
+
+				FlattenComponentsTask->PrepareRangesOnly(Nodes.Num(), ChunkSize);
+			});
 
-		int32 VisitedNum = 0;
+		UnionComponentsTask->SetOnIterationRangeStartCallback(
+			[this](const int32 StartIndex, const int32 Count, const int32 LoopIdx) { UnionComponents(StartIndex, Count); });
 
-		for (int i = 0; i < Nodes.Num(); ++i)
+		UnionComponentsTask->PrepareRangesOnly(Edges.Num(), ChunkSize);
+	}
+
+	void FGraph::PrepareComponents()
+	{
+		const int32 NumNodes = Nodes.Num();
+		const int32 NumEdges = Edges.Num();
+
+		PCGEX_SET_NUM_UNINITIALIZED(ComponentParents, NumNodes)
+		ExportedEdges.Init(false, NumEdges);
+
+		for (int i = 0; i < NumNodes; ++i)
 		{
-			const FNode& CurrentNode = Nodes[i];
+			ComponentParents[i] = i;
+			Nodes[i].NumExportedEdges = 0;
+		}
 
-			if (VisitedNodes[i]) { continue; }
+		// An edge is exported if it and both its endpoints are still valid
+		for (int i = 0; i < NumEdges; ++i)
+		{
+			const FIndexedEdge& Edge = Edges[i];
+			if (!Edge.bValid || !Nodes[Edge.Start].bValid || !Nodes[Edge.End].bValid) { continue; }
 
-			VisitedNodes[i] = true;
-			VisitedNum++;
+			ExportedEdges[i] = true;
+			Nodes[Edge.Start].NumExportedEdges++;
+			Nodes[Edge.End].NumExportedEdges++;
+		}
+	}
 
-			if (!CurrentNode.bValid || CurrentNode.Adjacency.IsEmpty()) { continue; }
+	void FGraph::UnionComponents(const int32 StartIndex, const int32 Count)
+	{
+		int32* ParentPtr = ComponentParents.GetData();
+		for (int i = StartIndex; i < StartIndex + Count; ++i)
+		{
+			if (!ExportedEdges[i]) { continue; }
+			const FIndexedEdge& Edge = Edges[i];
+			UFUnion(ParentPtr, Edge.Start, Edge.End);
+		}
+	}
 
-			FSubGraph* SubGraph = new FSubGraph();
-			SubGraph->ParentGraph = this;
+	void FGraph::FlattenComponents(const int32 StartIndex, const int32 Count)
+	{
+		// Parent becomes the root of every node that has at least one exported edge, -1 otherwise
+		int32* ParentPtr = ComponentParents.GetData();
+		for (int i = StartIndex; i < StartIndex + Count; ++i)
+		{
+			const int32 Root = Nodes[i].NumExportedEdges > 0 ? UFFind(ParentPtr, i) : -1;
+			FPlatformAtomics::InterlockedExchange(ParentPtr + i, Root);
+		}
+	}
 
-			TArray<int32> Stack;
-			Stack.Reserve(Nodes.Num() - VisitedNum);
-			Stack.Add(i);
+	void FGraph::BucketSubGraphs(const FPCGExGraphBuilderDetails& Limits)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::BucketSubGraphs);
 
-			while (Stack.Num() > 0)
-			{
-#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION <= 3
-				const int32 NextIndex = Stack.Pop(false);
-#else
-				const int32 NextIndex = Stack.Pop(EAllowShrinking::No);
-#endif
-				FNode& Node = Nodes[NextIndex];
-				Node.NumExportedEdges = 0;
-
-				for (const int32 E : Node.Adjacency)
-				{
-					if (VisitedEdges[E]) { continue; }
+		const int32 NumNodes = Nodes.Num();
+		const int32 NumEdges = Edges.Num();
+		const TArray<int32>& Parent = ComponentParents;
 
-					VisitedEdges[E] = true;
+		// Counting-sort nodes & edges into flat per-component buckets.
+		// Components are numbered by their lowest node index, edges & nodes stay in ascending order within a bucket.
 
-					const FIndexedEdge& Edge = Edges[E];
+		TArray<int32> ComponentIndex;
+		PCGEX_SET_NUM_UNINITIALIZED(ComponentIndex, NumNodes)
 
-					if (!Edge.bValid) { continue; }
+		int32 NumComponents = 0;
+		for (int i = 0; i < NumNodes; ++i) { ComponentIndex[i] = Parent[i] == i ? NumComponents++ : -1; }
 
-					const int32 OtherIndex = Edge.Other(NextIndex);
-					if (!Nodes[OtherIndex].bValid) { continue; }
+		if (NumComponents == 0)
+		{
+			ComponentParents.Empty();
+			ExportedEdges.Empty();
+			return;
+		}
 
-					Node.NumExportedEdges++;
-					SubGraph->Add(Edge, this);
+		TArray<int32> NodeOffsets;
+		TArray<int32> EdgeOffsets;
+		NodeOffsets.Init(0, NumComponents + 1);
+		EdgeOffsets.Init(0, NumComponents + 1);
 
-					if (!VisitedNodes[OtherIndex]) // Only enqueue if not already visited
-					{
-						VisitedNodes[OtherIndex] = true;
-						VisitedNum++;
+		for (int i = 0; i < NumNodes; ++i)
+		{
+			if (Parent[i] == -1) { continue; }
+			NodeOffsets[ComponentIndex[Parent[i]] + 1]++;
+		}
 
-						Stack.Add(OtherIndex);
-					}
-				}
+		for (int i = 0; i < NumEdges; ++i)
+		{
+			if (!ExportedEdges[i]) { continue; }
+			EdgeOffsets[ComponentIndex[Parent[Edges[i].Start]] + 1]++;
+		}
+
+		for (int i = 0; i < NumComponents; ++i)
+		{
+			NodeOffsets[i + 1] += NodeOffsets[i];
+			EdgeOffsets[i + 1] += EdgeOffsets[i];
+		}
+
+		PCGEX_SET_NUM_UNINITIALIZED(SubGraphNodes, NodeOffsets[NumComponents])
+		PCGEX_SET_NUM_UNINITIALIZED(SubGraphEdges, EdgeOffsets[NumComponents])
+
+		TArray<int32> FirstInIOIndices;
+		FirstInIOIndices.Init(-1, NumComponents);
+
+		{
+			TArray<int32> Cursor;
+			Cursor.Append(NodeOffsets.GetData(), NumComponents);
+			for (int i = 0; i < NumNodes; ++i)
+			{
+				if (Parent[i] == -1) { continue; }
+				SubGraphNodes[Cursor[ComponentIndex[Parent[i]]]++] = i;
+			}
+
+			Cursor.Reset();
+			Cursor.Append(EdgeOffsets.GetData(), NumComponents);
+			for (int i = 0; i < NumEdges; ++i)
+			{
+				if (!ExportedEdges[i]) { continue; }
+
+				const FIndexedEdge& Edge = Edges[i];
+				const int32 Component = ComponentIndex[Parent[Edge.Start]];
+				SubGraphEdges[Cursor[Component]++] = i;
+
+				if (FirstInIOIndices[Component] == -1 && Edge.IOIndex >= 0) { FirstInIOIndices[Component] = Edge.IOIndex; }
 			}
+		}
+
+		SubGraphs.Reserve(NumComponents);
 
+		for (int i = 0; i < NumComponents; ++i)
+		{
+			FSubGraph* SubGraph = new FSubGraph();
+			SubGraph->ParentGraph = this;
+			SubGraph->Nodes = TArrayView<const int32>(SubGraphNodes.GetData() + NodeOffsets[i], NodeOffsets[i + 1] - NodeOffsets[i]);
+			SubGraph->Edges = TArrayView<const int32>(SubGraphEdges.GetData() + EdgeOffsets[i], EdgeOffsets[i + 1] - EdgeOffsets[i]);
+			SubGraph->FirstInIOIndex = FirstInIOIndices[i];
 
 			if (!Limits.IsValid(SubGraph))
 			{
@@ -252,6 +401,64 @@ namespace PCGExGraph
 				SubGraphs.Add(SubGraph);
 			}
 		}
+
+		ComponentParents.Empty();
+		ExportedEdges.Empty();
+	}
+
+	void FGraph::BuildSubGraph(const PCGExCluster::FCluster* InCluster, const FPCGExGraphBuilderDetails& Limits)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::BuildSubGraphFromCluster);
+
+		check(Edges.IsEmpty())
+
+		const TArray<FIndexedEdge>& ClusterEdges = *InCluster->Edges;
+		Edges.Reserve(ClusterEdges.Num());
+
+		int32 FirstInIOIndex = -1;
+
+		for (FNode& Node : Nodes) { Node.NumExportedEdges = 0; }
+
+		// Cluster edges already address vtx points, which are our node indices
+		for (const FIndexedEdge& E : ClusterEdges)
+		{
+			if (!E.bValid) { continue; }
+
+			const int32 EdgeIndex = Edges.Emplace(Edges.Num(), E.Start, E.End, E.PointIndex, E.IOIndex);
+			FNode& StartNode = Nodes[E.Start];
+			FNode& EndNode = Nodes[E.End];
+
+			StartNode.Add(EdgeIndex);
+			EndNode.Add(EdgeIndex);
+			StartNode.NumExportedEdges++;
+			EndNode.NumExportedEdges++;
+
+			if (FirstInIOIndex == -1 && E.IOIndex >= 0) { FirstInIOIndex = E.IOIndex; }
+		}
+
+		if (Edges.IsEmpty()) { return; }
+
+		SubGraphNodes.Reserve(InCluster->Nodes->Num());
+		for (const FNode& Node : Nodes) { if (Node.NumExportedEdges > 0) { SubGraphNodes.Add(Node.NodeIndex); } }
+
+		PCGEX_SET_NUM_UNINITIALIZED(SubGraphEdges, Edges.Num())
+		for (int i = 0; i < SubGraphEdges.Num(); ++i) { SubGraphEdges[i] = i; }
+
+		FSubGraph* SubGraph = new FSubGraph();
+		SubGraph->ParentGraph = this;
+		SubGraph->Nodes = TArrayView<const int32>(SubGraphNodes);
+		SubGraph->Edges = TArrayView<const int32>(SubGraphEdges);
+		SubGraph->FirstInIOIndex = FirstInIOIndex;
+		SubGraph->SourceCluster = InCluster;
+
+		if (!Limits.IsValid(SubGraph))
+		{
+			SubGraph->Invalidate(this);
+			delete SubGraph;
+			return;
+		}
+
+		SubGraphs.Add(SubGraph);
 	}
 
 	void FGraph::GetConnectedNodes(const int32 FromIndex, TArray<int32>& OutIndices, const int32 SearchDepth) const
@@ -287,9 +494,15 @@ namespace PCGExGraph
 
 	void FGraphBuilder::Compile(PCGExMT::FTaskManager* AsyncManager, FGraphMetadataDetails* MetadataDetails)
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(FGraphBuilder::Compile);
+		if (SourceCluster) { Graph->BuildSubGraph(SourceCluster, *OutputDetails); }
+		else { Graph->BuildSubGraphs(*OutputDetails); }
+
+		CompileSubGraphs(AsyncManager, MetadataDetails);
+	}
 
-		Graph->BuildSubGraphs(*OutputDetails);
+	void FGraphBuilder::CompileSubGraphs(PCGExMT::FTaskManager* AsyncManager, FGraphMetadataDetails* MetadataDetails)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FGraphBuilder::Compile);
 
 		if (Graph->SubGraphs.IsEmpty())
 		{
@@ -461,7 +674,7 @@ namespace PCGExGraphTask
 		const TArray<FPCGPoint>& Vertices = VtxIO->GetPoints();
 
 		PCGExGraph::FGraph* Graph = SubGraph->ParentGraph;
-		TArray<int32> EdgeDump = SubGraph->Edges.Array();
+		const TArrayView<const int32> EdgeDump = SubGraph->Edges;
 		const int32 NumEdges = EdgeDump.Num();
 
 		TArray<PCGExGraph::FIndexedEdge>& FlattenedEdges = SubGraph->FlattenedEdges;
@@ -606,7 +819,21 @@ namespace PCGExGraphTask
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FCompileGraph::ExecuteTask);
 
-		Builder->Compile(Manager, MetadataDetails);
+		if (Builder->SourceCluster)
+		{
+			Builder->Compile(Manager, MetadataDetails);
+			return true;
+		}
+
+		// Component search runs as parallel ranges, the rest of the compilation picks up once it's done
+		// This task is deleted once executed, so the callback holds copies of what it needs
+		Builder->Graph->BuildSubGraphs(
+			Manager, *Builder->OutputDetails,
+			[InBuilder = Builder, InManager = Manager, InMetadataDetails = MetadataDetails]()
+			{
+				InBuilder->CompileSubGraphs(InManager, InMetadataDetails);
+			});
+
 		return true;
 	}
 
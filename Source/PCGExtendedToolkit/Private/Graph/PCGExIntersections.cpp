@@ -27,46 +27,11 @@ namespace PCGExGraph
 
 	FCompoundNode* FCompoundGraph::InsertPoint(const FPCGPoint& Point, const int32 IOIndex, const int32 PointIndex)
 	{
+		if (!Octree) { return InsertGridPoint(Point, IOIndex, PointIndex); }
+
 		const FVector Origin = Point.Transform.GetLocation();
 		FCompoundNode* Node;
 
-		if (!Octree)
-		{
-			const uint32 GridKey = FuseDetails.GetGridKey(Origin);
-			FCompoundNode** NodePtr;
-			{
-				FReadScopeLock ReadScopeLock(CompoundLock);
-				NodePtr = GridTree.Find(GridKey);
-			}
-
-			if (NodePtr)
-			{
-				Node = *NodePtr;
-				PointsCompounds->Add(Node->Index, IOIndex, PointIndex);
-				return Node;
-			}
-
-			{
-				FWriteScopeLock WriteLock(CompoundLock);
-				NodePtr = GridTree.Find(GridKey); // Make sure there hasn't been an insert while locking
-
-				if (NodePtr)
-				{
-					Node = *NodePtr;
-					PointsCompounds->Add(Node->Index, IOIndex, PointIndex);
-					return Node;
-				}
-
-				Node = new FCompoundNode(Point, Origin, Nodes.Num());
-
-				Nodes.Add(Node);
-				PointsCompounds->New(IOIndex, PointIndex);
-				GridTree.Add(GridKey, Node);
-			}
-
-			return Node;
-		}
-
 		{
 			// Read lock starts
 			int32 NodeIndex = -1;
@@ -127,28 +92,11 @@ namespace PCGExGraph
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FCompoundGraph::InsertPointUnsafe);
 
+		if (!Octree) { return InsertGridPoint(Point, IOIndex, PointIndex); } // Shard locks are uncontended here
+
 		const FVector Origin = Point.Transform.GetLocation();
 		FCompoundNode* Node;
 
-		if (!Octree)
-		{
-			const uint32 GridKey = FuseDetails.GetGridKey(Origin);
-
-			if (FCompoundNode** NodePtr = GridTree.Find(GridKey))
-			{
-				Node = *NodePtr;
-				PointsCompounds->Add(Node->Index, IOIndex, PointIndex);
-				return Node;
-			}
-
-			Node = new FCompoundNode(Point, Origin, Nodes.Num());
-			Nodes.Add(Node);
-			PointsCompounds->New(IOIndex, PointIndex);
-			GridTree.Add(GridKey, Node);
-
-			return Node;
-		}
-
 		int32 NodeIndex = -1;
 
 		if (FuseDetails.bComponentWiseTolerance)
@@ -193,6 +141,60 @@ namespace PCGExGraph
 		return Node;
 	}
 
+	FCompoundNode* FCompoundGraph::InsertGridPoint(const FPCGPoint& Point, const int32 IOIndex, const int32 PointIndex)
+	{
+		const FVector Origin = Point.Transform.GetLocation();
+		const FInt64Vector3 GridKey = FuseDetails.GetGridKey(Origin);
+		const uint64 H = PCGEx::H64(IOIndex, PointIndex);
+
+		const int32 ShardIndex = static_cast<int32>(PCGEx::GH64(GridKey) >> (64 - GridShardBits));
+		FCompoundGridShard* Shard = GridShards[ShardIndex];
+
+		FCompoundNode* Node = nullptr;
+		PCGExData::FIdxCompound* Compound = nullptr;
+
+		{
+			FReadScopeLock ReadScopeLock(Shard->ShardLock);
+			if (const int32* LocalIndex = Shard->Cells.Find(GridKey))
+			{
+				Node = Shard->Nodes[*LocalIndex];
+				Compound = Shard->Compounds[*LocalIndex];
+			}
+		}
+
+		if (!Node)
+		{
+			FWriteScopeLock WriteScopeLock(Shard->ShardLock);
+
+			if (const int32* LocalIndex = Shard->Cells.Find(GridKey)) // Make sure there hasn't been an insert while locking
+			{
+				Node = Shard->Nodes[*LocalIndex];
+				Compound = Shard->Compounds[*LocalIndex];
+			}
+			else
+			{
+				const int32 LocalIndex = Shard->Nodes.Num();
+
+				Node = new FCompoundNode(Point, Origin, (LocalIndex << GridShardBits) | ShardIndex);
+				Node->FirstHash = H;
+
+				Compound = new PCGExData::FIdxCompound();
+				Compound->Add(IOIndex, PointIndex);
+
+				Shard->Nodes.Add(Node);
+				Shard->Compounds.Add(Compound);
+				Shard->Cells.Add(GridKey, LocalIndex);
+
+				return Node;
+			}
+		}
+
+		Compound->Add(IOIndex, PointIndex);
+		Node->Represent(Point, H);
+
+		return Node;
+	}
+
 	PCGExData::FIdxCompound* FCompoundGraph::InsertEdge(const FPCGPoint& From, const int32 FromIOIndex, const int32 FromPointIndex, const FPCGPoint& To, const int32 ToIOIndex, const int32 ToPointIndex, const int32 EdgeIOIndex, const int32 EdgePointIndex)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FCompoundGraph::InsertEdge);
@@ -267,6 +269,111 @@ namespace PCGExGraph
 		return EdgeIdx;
 	}
 
+	void FCompoundGraph::Finalize()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FCompoundGraph::Finalize);
+
+		if (bFinalized) { return; }
+		bFinalized = true;
+
+		if (GridShards.IsEmpty()) { return; }
+
+		TArray<TArray<int32>> Remap;
+		Remap.SetNum(NumGridShards);
+
+		int32 NumGridNodes = 0;
+		for (int32 i = 0; i < NumGridShards; i++)
+		{
+			Remap[i].SetNumUninitialized(GridShards[i]->Nodes.Num());
+			NumGridNodes += GridShards[i]->Nodes.Num();
+		}
+
+		Nodes.Reset(NumGridNodes);
+		TArray<PCGExData::FIdxCompound*> Compounds;
+		Compounds.Reserve(NumGridNodes);
+
+		for (FCompoundGridShard* Shard : GridShards)
+		{
+			Nodes.Append(Shard->Nodes);
+			Shard->Nodes.Reset();
+		}
+
+		// Each source point belongs to a single voxel, so FirstHash is unique per node
+		Nodes.Sort([](const FCompoundNode& A, const FCompoundNode& B) { return A.FirstHash < B.FirstHash; });
+
+		for (int32 i = 0; i < NumGridNodes; i++)
+		{
+			FCompoundNode* Node = Nodes[i];
+			const int32 ShardIndex = Node->Index & (NumGridShards - 1);
+			const int32 LocalIndex = Node->Index >> GridShardBits;
+
+			Remap[ShardIndex][LocalIndex] = i;
+			Compounds.Add(GridShards[ShardIndex]->Compounds[LocalIndex]);
+			Node->Index = i;
+		}
+
+		for (FCompoundGridShard* Shard : GridShards) { Shard->Compounds.Reset(); }
+		PCGEX_DELETE_TARRAY(GridShards)
+
+		auto GetFinalIndex = [&](const int32 InIndex) { return Remap[InIndex & (NumGridShards - 1)][InIndex >> GridShardBits]; };
+
+		TArray<int32> Adjacency;
+		for (int32 i = 0; i < NumGridNodes; i++)
+		{
+			FCompoundNode* Node = Nodes[i];
+
+			Adjacency.Reset(Node->Adjacency.Num());
+			for (const int32 Other : Node->Adjacency) { Adjacency.Add(GetFinalIndex(Other)); }
+			Adjacency.Sort();
+
+			Node->Adjacency.Reset();
+			Node->Adjacency.Append(Adjacency);
+
+			Compounds[i]->IOIndices.Sort(TLess<int32>());
+			Compounds[i]->CompoundedHashSet.Sort(TLess<uint64>());
+		}
+
+		PCGEX_DELETE_TARRAY(PointsCompounds->Compounds)
+		PointsCompounds->Compounds = MoveTemp(Compounds);
+
+		if (Edges.IsEmpty()) { return; }
+
+		// Edges were indexed in arrival order; re-index them by their lowest source edge point
+
+		TArray<FIndexedEdge> SortedEdges;
+		Edges.GenerateValueArray(SortedEdges);
+
+		TArray<uint64> FirstEdgeHash;
+		FirstEdgeHash.SetNumUninitialized(EdgesCompounds->Num());
+		for (int32 i = 0; i < FirstEdgeHash.Num(); i++)
+		{
+			PCGExData::FIdxCompound* EdgeCompound = EdgesCompounds->Compounds[i];
+			EdgeCompound->IOIndices.Sort(TLess<int32>());
+			EdgeCompound->CompoundedHashSet.Sort(TLess<uint64>());
+
+			FirstEdgeHash[i] = MAX_uint64;
+			for (const uint64 H : EdgeCompound->CompoundedHashSet) { FirstEdgeHash[i] = FMath::Min(FirstEdgeHash[i], H); }
+		}
+
+		SortedEdges.Sort([&](const FIndexedEdge& A, const FIndexedEdge& B) { return FirstEdgeHash[A.EdgeIndex] < FirstEdgeHash[B.EdgeIndex]; });
+
+		TArray<PCGExData::FIdxCompound*> EdgeCompounds;
+		EdgeCompounds.Reserve(SortedEdges.Num());
+
+		Edges.Empty(SortedEdges.Num());
+		for (int32 i = 0; i < SortedEdges.Num(); i++)
+		{
+			const FIndexedEdge& E = SortedEdges[i];
+			const int32 Start = GetFinalIndex(E.Start);
+			const int32 End = GetFinalIndex(E.End);
+
+			EdgeCompounds.Add(EdgesCompounds->Compounds[E.EdgeIndex]);
+			Edges.Add(PCGEx::H64U(Start, End), FIndexedEdge(i, Start, End));
+		}
+
+		EdgesCompounds->Compounds = MoveTemp(EdgeCompounds);
+	}
+
 	void FCompoundGraph::GetUniqueEdges(TSet<uint64>& OutEdges)
 	{
 		OutEdges.Empty(Nodes.Num() * 4);
@@ -134,12 +134,7 @@ namespace PCGExMergeVertices
 
 	void FProcessor::CompleteWork()
 	{
-		TMap<int32, int32>* OffsetLookup = new TMap<int32, int32>();
-		OffsetLookup->Reserve(Cluster->NodeIndexLookup->Num());
-		for (const TPair<int32, int32>& Lookup : (*Cluster->NodeIndexLookup)) { OffsetLookup->Add(Lookup.Key + StartIndexOffset, Lookup.Value); }
-
-		PCGEX_DELETE(Cluster->NodeIndexLookup)
-		Cluster->NodeIndexLookup = OffsetLookup;
+		Cluster->NodeIndexLookup->ShiftKeys(StartIndexOffset);
 
 		StartParallelLoopForNodes();
 		StartParallelLoopForEdges();
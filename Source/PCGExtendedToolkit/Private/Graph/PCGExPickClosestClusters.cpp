@@ -157,7 +157,7 @@ namespace PCGExPickClosestClusters
 		LocalSettings = Settings;
 		LocalTypedContext = TypedContext;
 
-		Cluster->RebuildOctree(Settings->SearchMode);
+		Cluster->RebuildSpatialIndex(Settings->SearchMode);
 		Search();
 
 		return true;
@@ -181,20 +181,18 @@ namespace PCGExPickClosestClusters
 					const FVector TargetLocation = Point.Transform.GetLocation();
 
 					bool bFound = false;
-					Cluster->EdgeOctree->FindElementsWithBoundsTest(
-						FBoxCenterAndExtent(TargetLocation, Point.GetScaledExtents() + FVector(LocalSettings->TargetBoundsExpansion)), [&](const PCGExCluster::FClusterItemRef& ItemRef)
+					Cluster->EdgeBVH->FindOverlapping(
+						FBox::BuildAABB(TargetLocation, Point.GetScaledExtents() + FVector(LocalSettings->TargetBoundsExpansion)), [&](const int32 EdgeIndex)
 						{
-							Distances[Index] = FMath::Min(Distances[Index], FVector::DistSquared(TargetLocation, Cluster->GetClosestPointOnEdge(ItemRef.ItemIndex, TargetLocation)));
+							Distances[Index] = FMath::Min(Distances[Index], FVector::DistSquared(TargetLocation, Cluster->GetClosestPointOnEdge(EdgeIndex, TargetLocation)));
 							bFound = true;
+							return true;
 						});
+
 					if (!bFound && LocalSettings->bExpandSearchOutsideTargetBounds)
 					{
-						Cluster->EdgeOctree->FindNearbyElements(
-							TargetLocation, [&](const PCGExCluster::FClusterItemRef& ItemRef)
-							{
-								Distances[Index] = FMath::Min(Distances[Index], FVector::DistSquared(TargetLocation, Cluster->GetPos(ItemRef.ItemIndex)));
-								bFound = true;
-							});
+						double DistSquared = 0;
+						if (Cluster->FindClosestEdge(TargetLocation, DistSquared) != -1) { Distances[Index] = DistSquared; }
 					}
 				}, NumTargets, 256);
 		}
@@ -209,21 +207,19 @@ namespace PCGExPickClosestClusters
 					const FVector TargetLocation = Point.Transform.GetLocation();
 
 					bool bFound = false;
-					Cluster->NodeOctree->FindElementsWithBoundsTest(
-						FBoxCenterAndExtent(TargetLocation, Point.GetScaledExtents() + FVector(LocalSettings->TargetBoundsExpansion)), [&](const PCGExCluster::FClusterItemRef& ItemRef)
+					Cluster->NodeKDTree->FindInBox(
+						FBox::BuildAABB(TargetLocation, Point.GetScaledExtents() + FVector(LocalSettings->TargetBoundsExpansion)), [&](const int32 NodeIndex)
 						{
-							Distances[Index] = FMath::Min(Distances[Index], FVector::DistSquared(TargetLocation, Cluster->GetPos(ItemRef.ItemIndex)));
+							Distances[Index] = FMath::Min(Distances[Index], FVector::DistSquared(TargetLocation, Cluster->GetPos(NodeIndex)));
 							bFound = true;
 						});
 
 					if (!bFound && LocalSettings->bExpandSearchOutsideTargetBounds)
 					{
-						Cluster->NodeOctree->FindNearbyElements(
-							TargetLocation, [&](const PCGExCluster::FClusterItemRef& ItemRef)
-							{
-								Distances[Index] = FMath::Min(Distances[Index], FVector::DistSquared(TargetLocation, Cluster->GetPos(ItemRef.ItemIndex)));
-								bFound = true;
-							});
+						if (const int32 NodeIndex = Cluster->NodeKDTree->FindNearest(TargetLocation); NodeIndex != -1)
+						{
+							Distances[Index] = FVector::DistSquared(TargetLocation, Cluster->GetPos(NodeIndex));
+						}
 					}
 				}, NumTargets, 256);
 		}
@@ -85,7 +85,13 @@ namespace PCGExSimplifyClusters
 		{
 			PCGExClusterFilter::TManager* FilterManager = new PCGExClusterFilter::TManager(Cluster, VtxDataFacade, EdgeDataFacade);
 			FilterManager->Init(Context, TypedContext->FilterFactories);
-			for (const PCGExCluster::FNode& Node : *Cluster->Nodes) { Breakpoints[Node.NodeIndex] = Node.IsComplex() ? true : FilterManager->Test(Node); }
+
+			const int32 NumNodes = Cluster->Nodes->Num();
+			TArray<uint64> NodeBits;
+			PCGEX_SET_NUM_UNINITIALIZED(NodeBits, PCGExPointFilter::GetNumWords(NumNodes))
+			FilterManager->TestScope(Cluster->Nodes->GetData(), 0, NumNodes, NodeBits.GetData());
+
+			for (const PCGExCluster::FNode& Node : *Cluster->Nodes) { Breakpoints[Node.NodeIndex] = Node.IsComplex() || PCGExPointFilter::GetBit(NodeBits.GetData(), Node.NodeIndex); }
 			PCGEX_DELETE(FilterManager)
 		}
 		else
@@ -93,6 +99,8 @@ namespace PCGExSimplifyClusters
 			for (const PCGExCluster::FNode& Node : *Cluster->Nodes) { Breakpoints[Node.NodeIndex] = Node.IsComplex(); }
 		}
 
+		Cluster->RebuildAdjacencyCSR();
+
 		if (IsTrivial())
 		{
 			AsyncManagerPtr->StartSynchronous<PCGExClusterTask::FFindNodeChains>(
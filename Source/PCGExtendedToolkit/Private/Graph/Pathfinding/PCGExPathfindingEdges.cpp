@@ -242,13 +242,13 @@ namespace PCGExPathfindingEdge
 			if (Settings->SeedPicking.PickingMethod == EPCGExClusterClosestSearchMode::Node ||
 				Settings->GoalPicking.PickingMethod == EPCGExClusterClosestSearchMode::Node)
 			{
-				Cluster->RebuildOctree(EPCGExClusterClosestSearchMode::Node);
+				Cluster->RebuildSpatialIndex(EPCGExClusterClosestSearchMode::Node);
 			}
 
 			if (Settings->SeedPicking.PickingMethod == EPCGExClusterClosestSearchMode::Edge ||
 				Settings->GoalPicking.PickingMethod == EPCGExClusterClosestSearchMode::Edge)
 			{
-				Cluster->RebuildOctree(EPCGExClusterClosestSearchMode::Edge);
+				Cluster->RebuildSpatialIndex(EPCGExClusterClosestSearchMode::Edge);
 			}
 		}
 
@@ -368,8 +368,8 @@ namespace PCGExFindContours
 
 		if (!FClusterProcessor::Process(AsyncManager)) { return false; }
 
-		if (Settings->bUseOctreeSearch) { Cluster->RebuildOctree(Settings->SeedPicking.PickingMethod); }
-		Cluster->RebuildOctree(EPCGExClusterClosestSearchMode::Edge); // We need edge octree anyway
+		if (Settings->bUseOctreeSearch) { Cluster->RebuildSpatialIndex(Settings->SeedPicking.PickingMethod); }
+		Cluster->RebuildSpatialIndex(EPCGExClusterClosestSearchMode::Edge); // We need edge BVH anyway
 
 		ExpandedNodes = Cluster->ExpandedNodes;
 		ExpandedEdges = Cluster->GetExpandedEdges(true);
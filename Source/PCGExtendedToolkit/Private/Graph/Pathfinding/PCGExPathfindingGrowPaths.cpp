@@ -325,7 +325,7 @@ namespace PCGExGrowPaths
 		GrowthStop = Settings->bUseGrowthStop ? VtxDataFacade->GetBroadcaster<bool>(Settings->GrowthStopAttribute) : nullptr;
 		NoGrowth = Settings->bUseNoGrowth ? VtxDataFacade->GetBroadcaster<bool>(Settings->NoGrowthAttribute) : nullptr;
 
-		if (Settings->bUseOctreeSearch) { Cluster->RebuildOctree(Settings->SeedPicking.PickingMethod); }
+		if (Settings->bUseOctreeSearch) { Cluster->RebuildSpatialIndex(Settings->SeedPicking.PickingMethod); }
 
 		// Prepare growth points
 
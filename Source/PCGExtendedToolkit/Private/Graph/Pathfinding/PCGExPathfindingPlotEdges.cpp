@@ -243,13 +243,13 @@ namespace PCGExPathfindingPlotEdge
 			if (Settings->SeedPicking.PickingMethod == EPCGExClusterClosestSearchMode::Node ||
 				Settings->GoalPicking.PickingMethod == EPCGExClusterClosestSearchMode::Node)
 			{
-				Cluster->RebuildOctree(EPCGExClusterClosestSearchMode::Node);
+				Cluster->RebuildSpatialIndex(EPCGExClusterClosestSearchMode::Node);
 			}
 
 			if (Settings->SeedPicking.PickingMethod == EPCGExClusterClosestSearchMode::Edge ||
 				Settings->GoalPicking.PickingMethod == EPCGExClusterClosestSearchMode::Edge)
 			{
-				Cluster->RebuildOctree(EPCGExClusterClosestSearchMode::Edge);
+				Cluster->RebuildSpatialIndex(EPCGExClusterClosestSearchMode::Edge);
 			}
 		}
 
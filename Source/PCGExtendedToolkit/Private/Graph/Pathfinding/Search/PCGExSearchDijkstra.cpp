@@ -67,7 +67,7 @@ bool UPCGExSearchDijkstra::FindPath(
 		if (Visited[CurrentNodeIndex]) { continue; }
 		Visited[CurrentNodeIndex] = true;
 
-		for (const uint64 AdjacencyHash : Current.Adjacency)
+		for (const uint64 AdjacencyHash : Cluster->GetAdjacency(CurrentNodeIndex))
 		{
 			uint32 NeighborIndex;
 			uint32 EdgeIndex;
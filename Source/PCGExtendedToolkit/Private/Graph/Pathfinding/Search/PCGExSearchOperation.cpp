@@ -12,6 +12,7 @@ void UPCGExSearchOperation::CopySettingsFrom(const UPCGExOperation* Other)
 void UPCGExSearchOperation::PrepareForCluster(PCGExCluster::FCluster* InCluster)
 {
 	Cluster = InCluster;
+	Cluster->RebuildAdjacencyCSR(); // Searches expand a lot of nodes; keep neighbors contiguous
 }
 
 bool UPCGExSearchOperation::FindPath(
@@ -42,6 +42,55 @@ bool PCGExPointsFilter::TDotFilter::Init(const FPCGContext* InContext, PCGExData
 	return true;
 }
 
+void PCGExPointsFilter::TDotFilter::TestScope(const int32 StartIndex, const int32 Count, uint64* OutBits) const
+{
+	const FPCGExDotFilterConfig& Config = TypedFilterFactory->Config;
+
+	// Gather dot values first; the comparison pass is then a flat kernel
+	TArray<double> Dots;
+	PCGEX_SET_NUM_UNINITIALIZED(Dots, Count)
+
+	for (int i = 0; i < Count; ++i)
+	{
+		const int32 PointIndex = StartIndex + i;
+		const FPCGPoint& Point = PointDataFacade->Source->GetInPoint(PointIndex);
+
+		const FVector A = Config.bTransformOperandA ?
+			                  OperandA->Values[PointIndex] :
+			                  Point.Transform.TransformVectorNoScale(OperandA->Values[PointIndex]);
+
+		FVector B = OperandB ? OperandB->Values[PointIndex].GetSafeNormal() : Config.OperandBConstant;
+		if (Config.bTransformOperandB) { B = Point.Transform.TransformVectorNoScale(B); }
+
+		Dots[i] = DotComparison.bUnsignedDot ? FMath::Abs(FVector::DotProduct(A, B)) : FVector::DotProduct(A, B);
+	}
+
+	const double* D = Dots.GetData();
+
+	if (DotComparison.bUseLocalDot)
+	{
+		TArray<double> Thresholds;
+		PCGEX_SET_NUM_UNINITIALIZED(Thresholds, Count)
+		for (int i = 0; i < Count; ++i) { Thresholds[i] = DotComparison.GetDot(StartIndex + i); }
+
+		const double* T = Thresholds.GetData();
+		PCGExPointFilter::PackCompare(
+			DotComparison.Comparison, Count, OutBits,
+			[&](const int32 i) { return D[i]; },
+			[&](const int32 i) { return T[i]; },
+			DotComparison.DotTolerance);
+	}
+	else
+	{
+		const double Threshold = DotComparison.DotConstant;
+		PCGExPointFilter::PackCompare(
+			DotComparison.Comparison, Count, OutBits,
+			[&](const int32 i) { return D[i]; },
+			[Threshold](const int32 i) { return Threshold; },
+			DotComparison.DotTolerance);
+	}
+}
+
 PCGEX_CREATE_FILTER_FACTORY(Dot)
 
 #if WITH_EDITOR
@@ -33,6 +33,8 @@ UPCGExParamFactoryBase* UPCGExFilterGroupProviderSettings::CreateFactory(FPCGExC
 
 	NewFactory->Priority = Priority;
 	NewFactory->bInvert = bInvert;
+	NewFactory->bReorderBySelectivity = bReorderBySelectivity;
+	NewFactory->SelectivitySampleSize = SelectivitySampleSize;
 	NewFactory->FilterFactories;
 
 	if (!GetInputFactories(
@@ -48,6 +48,36 @@ bool PCGExPointsFilter::TModuloComparisonFilter::Init(const FPCGContext* InConte
 	return true;
 }
 
+void PCGExPointsFilter::TModuloComparisonFilter::TestScope(const int32 StartIndex, const int32 Count, uint64* OutBits) const
+{
+	const double* A = OperandA->Values.GetData() + StartIndex;
+	const FPCGExModuloCompareFilterConfig& Config = TypedFilterFactory->Config;
+
+	auto Compare = [&](auto&& GetB, auto&& GetC)
+	{
+		PCGExPointFilter::PackCompare(
+			Config.Comparison, Count, OutBits,
+			[&](const int32 i) { return FMath::Fmod(A[i], GetB(i)); },
+			GetC, Config.Tolerance);
+	};
+
+	const double ConstantB = Config.OperandBConstant;
+	const double ConstantC = Config.OperandCConstant;
+	const double* B = OperandB ? OperandB->Values.GetData() + StartIndex : nullptr;
+	const double* C = OperandC ? OperandC->Values.GetData() + StartIndex : nullptr;
+
+	if (B)
+	{
+		if (C) { Compare([&](const int32 i) { return B[i]; }, [&](const int32 i) { return C[i]; }); }
+		else { Compare([&](const int32 i) { return B[i]; }, [&](const int32 i) { return ConstantC; }); }
+	}
+	else
+	{
+		if (C) { Compare([&](const int32 i) { return ConstantB; }, [&](const int32 i) { return C[i]; }); }
+		else { Compare([&](const int32 i) { return ConstantB; }, [&](const int32 i) { return ConstantC; }); }
+	}
+}
+
 PCGEX_CREATE_FILTER_FACTORY(ModuloCompare)
 
 #if WITH_EDITOR
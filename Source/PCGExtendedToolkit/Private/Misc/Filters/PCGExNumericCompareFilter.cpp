@@ -37,6 +37,31 @@ bool PCGExPointsFilter::TNumericComparisonFilter::Init(const FPCGContext* InCont
 	return true;
 }
 
+void PCGExPointsFilter::TNumericComparisonFilter::TestScope(const int32 StartIndex, const int32 Count, uint64* OutBits) const
+{
+	const double* A = OperandA->Values.GetData() + StartIndex;
+	const FPCGExNumericCompareFilterConfig& Config = TypedFilterFactory->Config;
+
+	if (OperandB)
+	{
+		const double* B = OperandB->Values.GetData() + StartIndex;
+		PCGExPointFilter::PackCompare(
+			Config.Comparison, Count, OutBits,
+			[&](const int32 i) { return A[i]; },
+			[&](const int32 i) { return B[i]; },
+			Config.Tolerance);
+	}
+	else
+	{
+		const double B = Config.OperandBConstant;
+		PCGExPointFilter::PackCompare(
+			Config.Comparison, Count, OutBits,
+			[&](const int32 i) { return A[i]; },
+			[B](const int32 i) { return B; },
+			Config.Tolerance);
+	}
+}
+
 PCGEX_CREATE_FILTER_FACTORY(NumericCompare)
 
 #if WITH_EDITOR
@@ -32,6 +32,18 @@ bool PCGExPointsFilter::TWithinRangeFilter::Init(const FPCGContext* InContext, P
 	return true;
 }
 
+void PCGExPointsFilter::TWithinRangeFilter::TestScope(const int32 StartIndex, const int32 Count, uint64* OutBits) const
+{
+	const double* A = OperandA->Values.GetData() + StartIndex;
+	const double Min = RealMin;
+	const double Max = RealMax;
+
+	if (bInclusive) { PCGExPointFilter::PackBits(Count, OutBits, [&](const int32 i) { return (A[i] >= Min) & (A[i] <= Max); }); }
+	else { PCGExPointFilter::PackBits(Count, OutBits, [&](const int32 i) { return (A[i] >= Min) & (A[i] < Max); }); }
+
+	if (bInvert) { PCGExPointFilter::InvertBits(OutBits, Count); }
+}
+
 PCGEX_CREATE_FILTER_FACTORY(WithinRange)
 
 #if WITH_EDITOR
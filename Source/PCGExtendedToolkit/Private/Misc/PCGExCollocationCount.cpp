@@ -77,6 +77,7 @@ namespace PCGExCollocationCount
 
 		Octree = &PointDataFacade->Source->GetIn()->GetOctree();
 
+		PointsProcessingOrder = Settings->ProcessingOrder;
 		StartParallelLoopForPoints();
 
 		return true;
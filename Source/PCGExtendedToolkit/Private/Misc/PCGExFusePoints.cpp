@@ -92,7 +92,7 @@ namespace PCGExFusePoints
 		return true;
 	}
 
-	void FProcessor::ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const int32 LoopIdx, const int32 LoopCount)
+	void FProcessor::ProcessSingleInPoint(const int32 Index, const FPCGPoint& Point, const int32 LoopIdx, const int32 LoopCount)
 	{
 		CompoundGraph->InsertPoint(Point, PointIO->IOIndex, Index);
 	}
@@ -116,6 +116,8 @@ namespace PCGExFusePoints
 	{
 		PCGEX_TYPED_CONTEXT_AND_SETTINGS(FusePoints)
 
+		CompoundGraph->Finalize();
+
 		const int32 NumCompoundNodes = CompoundGraph->Nodes.Num();
 		PointIO->InitializeNum(NumCompoundNodes);
 
@@ -5,6 +5,9 @@
 
 #include "Data/PCGExData.h"
 #include "Sampling/PCGExSampling.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Sort.h"
+#include "Async/TaskGraphInterfaces.h"
 
 #define LOCTEXT_NAMESPACE "PCGExPartitionByValues"
 #define PCGEX_NAMESPACE PartitionByValues
@@ -14,87 +17,6 @@ namespace PCGExPartitionByValues
 	const FName SourceLabel = TEXT("Source");
 }
 
-namespace PCGExPartition
-{
-	FKPartition::FKPartition(FKPartition* InParent, const int64 InKey, FPCGExFilter::FRule* InRule, const int32 InPartitionIndex)
-		: Parent(InParent), PartitionIndex(InPartitionIndex), PartitionKey(InKey), Rule(InRule)
-	{
-	}
-
-	FKPartition::~FKPartition()
-	{
-		PCGEX_DELETE_TMAP(SubLayers, int64)
-		UniquePartitionKeys.Empty();
-	}
-
-	int32 FKPartition::GetSubPartitionsNum()
-	{
-		if (SubLayers.IsEmpty()) { return 1; }
-
-		int32 Num = 0;
-		for (const TPair<int64, FKPartition*>& Pair : SubLayers) { Num += Pair.Value->GetSubPartitionsNum(); }
-		return Num;
-	}
-
-	FKPartition* FKPartition::GetPartition(const int64 Key, FPCGExFilter::FRule* InRule)
-	{
-		FKPartition** LayerPtr;
-
-		{
-			FReadScopeLock ReadLock(LayersLock);
-			LayerPtr = SubLayers.Find(Key);
-			if (LayerPtr) { return *LayerPtr; }
-		}
-
-		{
-			FWriteScopeLock WriteLock(LayersLock);
-			LayerPtr = SubLayers.Find(Key);
-
-			if (LayerPtr) { return *LayerPtr; }
-
-			FKPartition* Partition = new FKPartition(this, Key, InRule, SubLayers.Num());
-
-			UniquePartitionKeys.Add(Key);
-			SubLayers.Add(Key, Partition);
-			return Partition;
-		}
-	}
-
-	void FKPartition::Register(TArray<FKPartition*>& Partitions)
-	{
-		if (!SubLayers.IsEmpty())
-		{
-			for (const TPair<int64, FKPartition*>& Pair : SubLayers) { Pair.Value->Register(Partitions); }
-		}
-		else
-		{
-			Partitions.Add(this);
-		}
-	}
-
-	void FKPartition::SortPartitions()
-	{
-		TMap<int64, int64> ValuesIndices;
-		TArray<int64> UValues = UniquePartitionKeys.Array();
-		UValues.Sort();
-
-		int64 PIndex = 0;
-		for (int64 UniquePartitionKey : UValues) { ValuesIndices.Add(UniquePartitionKey, PIndex++); }
-		UValues.Empty();
-
-		for (const TPair<int64, FKPartition*>& Pair : SubLayers)
-		{
-			Pair.Value->SortPartitions();
-			Pair.Value->PartitionIndex = *ValuesIndices.Find(Pair.Value->PartitionKey); //Ordered index
-		}
-
-		Points.Sort([](const int32& A, const int32& B) { return A < B; });
-
-		ValuesIndices.Empty();
-		UniquePartitionKeys.Empty();
-	}
-}
-
 #if WITH_EDITOR
 void UPCGExPartitionByValuesSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
@@ -203,7 +125,6 @@ namespace PCGExPartitionByValues
 {
 	FProcessor::~FProcessor()
 	{
-		PCGEX_DELETE(RootPartition)
 	}
 
 	bool FProcessor::Process(PCGExMT::FTaskManager* AsyncManager)
@@ -212,10 +133,9 @@ namespace PCGExPartitionByValues
 
 		if (!FPointsProcessor::Process(AsyncManager)) { return false; }
 
+		LocalSettings = Settings;
 		LocalTypedContext = TypedContext;
 
-		RootPartition = new PCGExPartition::FKPartition(nullptr, 0, nullptr, -1);
-
 		Rules.Empty(); //
 		PointIO->CreateInKeys();
 
@@ -225,17 +145,18 @@ namespace PCGExPartitionByValues
 
 		for (FPCGExPartitonRuleConfig& Config : TypedContext->RulesConfigs)
 		{
-			FPCGExFilter::FRule& NewRule = Rules.Emplace_GetRef(Config);
 			PCGExData::TCache<double>* DataCache = PointDataFacade->GetScopedBroadcaster<double>(Config.Selector);
+			if (!DataCache) { continue; }
 
-			if (!DataCache) { Rules.Pop(); }
-
+			FPCGExFilter::FRule& NewRule = Rules.Emplace_GetRef(Config);
 			NewRule.DataCache = DataCache;
 		}
 
 		// Prepare each rule so it cache the filter key by index
 		for (FPCGExFilter::FRule& Rule : Rules) { Rule.FilteredValues.SetNumZeroed(NumPoints); }
 
+		if (Settings->bSplitOutput) { PCGEX_SET_NUM_UNINITIALIZED(PointKeys, NumPoints) }
+
 		StartParallelLoopForPoints(PCGExData::ESource::In);
 
 		return true;
@@ -246,96 +167,348 @@ namespace PCGExPartitionByValues
 		PointDataFacade->Fetch(StartIndex, Count);
 	}
 
-	void FProcessor::ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const int32 LoopIdx, const int32 Count)
+	void FProcessor::ProcessSingleInPoint(const int32 Index, const FPCGPoint& Point, const int32 LoopIdx, const int32 Count)
 	{
-		PCGExPartition::FKPartition* Partition = RootPartition;
+		uint64 Key = 0;
 		for (FPCGExFilter::FRule& Rule : Rules)
 		{
 			const int64 KeyValue = Rule.Filter(Index);
-			Partition = Partition->GetPartition(KeyValue, &Rule);
 			Rule.FilteredValues[Index] = KeyValue;
+			Key = PCGExPartition::CombineKey(Key, KeyValue);
 		}
 
-		Partition->Add(Index);
+		if (!PointKeys.IsEmpty()) { PointKeys[Index] = Key; }
 	}
 
-	void FProcessor::ProcessSingleRangeIteration(const int32 Iteration, const int32 LoopIdx, const int32 LoopCount)
+	void FProcessor::CountKeys(const int32 StartIndex, const int32 Count, const int32 LoopIdx)
 	{
-		PCGEX_TYPED_CONTEXT_AND_SETTINGS(PartitionByValuesBase)
+		PCGExPartition::FChunkHistogram& Histogram = Histograms[LoopIdx];
+		Histogram.Start = StartIndex;
+		Histogram.Count = Count;
 
-		PCGExPartition::FKPartition* Partition = Partitions[Iteration];
+		const int32 MaxIndex = StartIndex + Count;
+		for (int i = StartIndex; i < MaxIndex; ++i)
+		{
+			const uint64 Key = PointKeys[i];
+			const int32* LocalIndex = Histogram.LocalIndices.Find(Key);
+
+			if (LocalIndex)
+			{
+				Histogram.Counts[*LocalIndex]++;
+				PointLocalIndices[i] = *LocalIndex;
+			}
+			else
+			{
+				const int32 NewIndex = Histogram.Keys.Add(Key);
+				Histogram.Counts.Add(1);
+				Histogram.LocalIndices.Add(Key, NewIndex);
+				PointLocalIndices[i] = NewIndex;
+			}
+		}
+	}
+
+	void FProcessor::BuildPartitions()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExPartitionByValues::BuildPartitions);
+
+		// Walking chunks in order yields partitions sorted by their lowest point index
+		TMap<uint64, int32> PartitionIndices;
+
+		for (int c = 0; c < Histograms.Num(); ++c)
+		{
+			PCGExPartition::FChunkHistogram& Histogram = Histograms[c];
+			PCGEX_SET_NUM_UNINITIALIZED(Histogram.PartitionIndices, Histogram.Keys.Num())
+
+			for (int k = 0; k < Histogram.Keys.Num(); ++k)
+			{
+				const uint64 Key = Histogram.Keys[k];
+				const int32* PartitionIndex = PartitionIndices.Find(Key);
+
+				if (PartitionIndex)
+				{
+					Histogram.PartitionIndices[k] = *PartitionIndex;
+					Partitions[*PartitionIndex].Count += Histogram.Counts[k];
+					continue;
+				}
+
+				Histogram.PartitionIndices[k] = Partitions.Num();
+				PartitionIndices.Add(Key, Partitions.Num());
+				PCGExPartition::FPartition& Partition = Partitions.Emplace_GetRef();
+				Partition.Key = Key;
+				Partition.Count = Histogram.Counts[k];
+			}
+		}
+
+		NumPartitions = Partitions.Num();
+
+		// Prefix sum
+		int32 Offset = 0;
+		for (PCGExPartition::FPartition& Partition : Partitions)
+		{
+			Partition.Start = Offset;
+			Offset += Partition.Count;
+		}
+
+		// Each chunk writes at the current running offset of its keys, which keeps indices sorted within partitions
+		TArray<int32> Cursors;
+		Cursors.Reserve(NumPartitions);
+		for (const PCGExPartition::FPartition& Partition : Partitions) { Cursors.Add(Partition.Start); }
+
+		for (PCGExPartition::FChunkHistogram& Histogram : Histograms)
+		{
+			PCGEX_SET_NUM_UNINITIALIZED(Histogram.Cursors, Histogram.Keys.Num())
+			for (int k = 0; k < Histogram.Keys.Num(); ++k)
+			{
+				int32& Cursor = Cursors[Histogram.PartitionIndices[k]];
+				Histogram.Cursors[k] = Cursor;
+				Cursor += Histogram.Counts[k];
+			}
+
+			Histogram.LocalIndices.Empty();
+		}
+
+		PCGEX_SET_NUM_UNINITIALIZED(PartitionedPoints, Offset)
+	}
+
+	void FProcessor::ScatterPoints(const int32 HistogramIndex)
+	{
+		PCGExPartition::FChunkHistogram& Histogram = Histograms[HistogramIndex];
+
+		const int32 MaxIndex = Histogram.Start + Histogram.Count;
+		for (int i = Histogram.Start; i < MaxIndex; ++i) { PartitionedPoints[Histogram.Cursors[PointLocalIndices[i]]++] = i; }
+	}
+
+	void FProcessor::ComputePartitionRanks()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExPartitionByValues::ComputePartitionRanks);
+
+		const int32 NumRules = Rules.Num();
+
+		for (PCGExPartition::FPartition& Partition : Partitions) { Partition.FirstPoint = PartitionedPoints[Partition.Start]; }
+
+		// Combined keys are hashes; make sure no two distinct value sets ended up together
+		if (NumRules > 1) { ResolveKeyCollisions(); }
+
+		// Rank of each rule value among partitions sharing the same parent values.
+		// Parents are tracked as exact group ids rather than combined keys, so ranks can't collide either.
+		PCGEX_SET_NUM_UNINITIALIZED(PartitionRanks, NumPartitions * NumRules)
+
+		TArray<int32> PrefixGroups;
+		PrefixGroups.Init(0, NumPartitions);
+
+		TMap<int32, TArray<int64>> Siblings;
+		TMap<TPair<int32, int64>, int32> ChildGroups;
+
+		for (int r = 0; r < NumRules; ++r)
+		{
+			const TArray<int64>& Values = Rules[r].FilteredValues;
+
+			Siblings.Reset();
+			for (int p = 0; p < NumPartitions; ++p) { Siblings.FindOrAdd(PrefixGroups[p]).AddUnique(Values[Partitions[p].FirstPoint]); }
+			for (TPair<int32, TArray<int64>>& Pair : Siblings) { Pair.Value.Sort(); }
+
+			ChildGroups.Reset();
+			for (int p = 0; p < NumPartitions; ++p)
+			{
+				const int64 Value = Values[Partitions[p].FirstPoint];
+				PartitionRanks[p * NumRules + r] = Algo::LowerBound(Siblings[PrefixGroups[p]], Value);
+				PrefixGroups[p] = ChildGroups.FindOrAdd(TPair<int32, int64>(PrefixGroups[p], Value), ChildGroups.Num());
+			}
+		}
+	}
+
+	void FProcessor::ResolveKeyCollisions()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExPartitionByValues::ResolveKeyCollisions);
+
+		auto SameValues = [&](const int32 A, const int32 B)
+		{
+			for (const FPCGExFilter::FRule& Rule : Rules) { if (Rule.FilteredValues[A] != Rule.FilteredValues[B]) { return false; } }
+			return true;
+		};
+
+		TArray<PCGExPartition::FPartition> ExactPartitions;
+		ExactPartitions.Reserve(NumPartitions);
+
+		TArray<int32> Groups;
+		TArray<int32> GroupFirstPoints;
+		TArray<int32> GroupCursors;
+		TArray<int32> Scratch;
+
+		for (const PCGExPartition::FPartition& Partition : Partitions)
+		{
+			const int32* Points = PartitionedPoints.GetData() + Partition.Start;
+
+			int32 i = 1;
+			while (i < Partition.Count && SameValues(Points[i], Partition.FirstPoint)) { ++i; }
+
+			if (i == Partition.Count)
+			{
+				ExactPartitions.Add(Partition);
+				continue;
+			}
+
+			bKeyCollision = true;
+
+			// Split by exact values. Collisions are rare enough that a linear scan over the distinct value sets will do.
+			PCGEX_SET_NUM_UNINITIALIZED(Groups, Partition.Count)
+			GroupFirstPoints.Reset();
+			GroupCursors.Reset();
+
+			for (int j = 0; j < Partition.Count; ++j)
+			{
+				int32 Group = 0;
+				while (Group < GroupFirstPoints.Num() && !SameValues(GroupFirstPoints[Group], Points[j])) { ++Group; }
+
+				if (Group == GroupFirstPoints.Num())
+				{
+					GroupFirstPoints.Add(Points[j]);
+					GroupCursors.Add(0);
+				}
+
+				GroupCursors[Group]++;
+				Groups[j] = Group;
+			}
+
+			int32 Offset = Partition.Start;
+			for (int g = 0; g < GroupFirstPoints.Num(); ++g)
+			{
+				PCGExPartition::FPartition& ExactPartition = ExactPartitions.Emplace_GetRef();
+				ExactPartition.Key = Partition.Key;
+				ExactPartition.FirstPoint = GroupFirstPoints[g];
+				ExactPartition.Start = Offset;
+				ExactPartition.Count = GroupCursors[g];
+
+				GroupCursors[g] = Offset;
+				Offset += ExactPartition.Count;
+			}
+
+			// Stable scatter keeps indices sorted within each split partition
+			Scratch = TArray<int32>(Points, Partition.Count);
+			for (int j = 0; j < Partition.Count; ++j) { PartitionedPoints[GroupCursors[Groups[j]]++] = Scratch[j]; }
+		}
+
+		if (!bKeyCollision) { return; }
+
+		// Keep partitions ordered by their lowest point index
+		Algo::SortBy(ExactPartitions, &PCGExPartition::FPartition::FirstPoint);
+
+		Partitions = MoveTemp(ExactPartitions);
+		NumPartitions = Partitions.Num();
+	}
+
+	void FProcessor::ProcessSingleRangeIteration(const int32 Iteration, const int32 LoopIdx, const int32 LoopCount)
+	{
+		const PCGExPartition::FPartition& Partition = Partitions[Iteration];
 
 		//Manually create & insert partition at the sorted IO Index
-		PCGExData::FPointIO* PartitionIO = TypedContext->MainPoints->Pairs[Partition->IOIndex];
+		PCGExData::FPointIO* PartitionIO = LocalTypedContext->MainPoints->Pairs[Partition.IOIndex];
 
 		UPCGMetadata* Metadata = PartitionIO->GetOut()->Metadata;
 
 		const TArray<FPCGPoint>& InPoints = PartitionIO->GetIn()->GetPoints();
 		TArray<FPCGPoint>& OutPoints = PartitionIO->GetOut()->GetMutablePoints();
-		PCGEX_SET_NUM_UNINITIALIZED(OutPoints, Partition->Points.Num())
+		PCGEX_SET_NUM_UNINITIALIZED(OutPoints, Partition.Count)
 
+		const int32* PointIndices = PartitionedPoints.GetData() + Partition.Start;
 		for (int i = 0; i < OutPoints.Num(); ++i)
 		{
-			OutPoints[i] = InPoints[Partition->Points[i]];
+			OutPoints[i] = InPoints[PointIndices[i]];
 			Metadata->InitializeOnSet(OutPoints[i].MetadataEntry);
 		}
 
+		const int32 NumRules = Rules.Num();
+
 		int64 Sum = 0;
-		while (Partition->Parent)
+		for (int r = NumRules - 1; r >= 0; --r)
 		{
-			const FPCGExFilter::FRule* Rule = Partition->Rule;
-			Sum += Partition->PartitionKey;
+			const FPCGExFilter::FRule& Rule = Rules[r];
+			const int64 PartitionKey = Rule.FilteredValues[Partition.FirstPoint];
+			const int32 PartitionIndex = PartitionRanks[Iteration * NumRules + r];
 
-			if (Rule->RuleConfig->bWriteKey)
+			Sum += PartitionKey;
+
+			if (Rule.RuleConfig->bWriteKey)
 			{
 				PCGExData::WriteMark<int64>(
 					Metadata,
-					Rule->RuleConfig->KeyAttributeName,
-					Rule->RuleConfig->bUsePartitionIndexAsKey ? Partition->PartitionIndex : Partition->PartitionKey);
+					Rule.RuleConfig->KeyAttributeName,
+					Rule.RuleConfig->bUsePartitionIndexAsKey ? PartitionIndex : PartitionKey);
 			}
 
-			if (Rule->RuleConfig->bWriteTag)
+			if (Rule.RuleConfig->bWriteTag)
 			{
 				FString TagValue;
 				PartitionIO->Tags->Add(
-					Rule->RuleConfig->TagPrefixName.ToString(),
-					Rule->RuleConfig->bTagUsePartitionIndexAsKey ? Partition->PartitionIndex : Partition->PartitionKey,
+					Rule.RuleConfig->TagPrefixName.ToString(),
+					Rule.RuleConfig->bTagUsePartitionIndexAsKey ? PartitionIndex : PartitionKey,
 					TagValue);
 			}
-
-			Partition = Partition->Parent;
 		}
 
-		if (Settings->bWriteKeySum) { PCGExData::WriteMark<int64>(Metadata, Settings->KeySumAttributeName, Sum); }
+		if (LocalSettings->bWriteKeySum) { PCGExData::WriteMark<int64>(Metadata, LocalSettings->KeySumAttributeName, Sum); }
 	}
 
 	void FProcessor::CompleteWork()
 	{
 		FPointsProcessor::CompleteWork();
-		RootPartition->SortPartitions();
 
 		PCGEX_TYPED_CONTEXT_AND_SETTINGS(PartitionByValuesBase)
 
 		if (Settings->bSplitOutput)
 		{
-			NumPartitions = RootPartition->GetSubPartitionsNum();
-			Partitions.Reserve(NumPartitions);
-			RootPartition->Register(Partitions);
+			const int32 NumPoints = PointKeys.Num();
+			if (!NumPoints) { return; }
 
-			// Sort by point index & ensure consistent output partition order
+			PCGEX_SET_NUM_UNINITIALIZED(PointLocalIndices, NumPoints)
 
-			Partitions.Sort([](const PCGExPartition::FKPartition& A, PCGExPartition::FKPartition& B) { return A.Points[0] < B.Points[0]; });
-			const int32 InsertOffset = TypedContext->MainPoints->Pairs.Num();
+			PCGEX_ASYNC_GROUP(AsyncManagerPtr, CountKeysTask)
+			CountKeysTask->SetOnCompleteCallback(
+				[&]()
+				{
+					BuildPartitions();
 
-			int32 SumPts = 0;
-			for (int i = 0; i < Partitions.Num(); ++i)
-			{
-				Partitions[i]->IOIndex = InsertOffset + i;
-				TypedContext->MainPoints->Emplace_GetRef(PointIO, PCGExData::EInit::NewOutput);
-				SumPts += Partitions[i]->Points.Num();
-			}
+					PCGEX_ASYNC_GROUP(AsyncManagerPtr, ScatterTask)
+					ScatterTask->SetOnCompleteCallback(
+						[&]()
+						{
+							Histograms.Empty();
+							PointLocalIndices.Empty();
+							PointKeys.Empty();
+
+							ComputePartitionRanks();
+
+							if (bKeyCollision)
+							{
+								PCGE_LOG_C(Verbose, LogOnly, LocalTypedContext, FTEXT("Partition key collision : colliding partitions were split by exact values."));
+							}
+
+							const int32 InsertOffset = LocalTypedContext->MainPoints->Pairs.Num();
+							for (int i = 0; i < NumPartitions; ++i)
+							{
+								Partitions[i].IOIndex = InsertOffset + i;
+								LocalTypedContext->MainPoints->Emplace_GetRef(PointIO, PCGExData::EInit::NewOutput);
+							}
+
+							StartParallelLoopForRange(NumPartitions, 64); // Too low maybe?
+						});
+
+					// One iteration per counted chunk, so scatter doesn't depend on the chunking being reproduced
+					ScatterTask->StartRanges(
+						[&](const int32 Index, const int32 Count, const int32 LoopIdx) { ScatterPoints(Index); },
+						Histograms.Num(), 1);
+				});
+
+			CountKeysTask->SetOnIterationRangePrepareCallback(
+				[&](const TArray<uint64>& Loops) { Histograms.SetNum(Loops.Num()); });
+
+			CountKeysTask->SetOnIterationRangeStartCallback(
+				[&](const int32 StartIndex, const int32 Count, const int32 LoopIdx) { CountKeys(StartIndex, Count, LoopIdx); });
+
+			// Roughly one histogram per worker keeps the serial merge in BuildPartitions short
+			const int32 NumWorkers = FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads());
+			CountKeysTask->PrepareRangesOnly(NumPoints, FMath::Max(GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize(), FMath::DivideAndRoundUp(NumPoints, NumWorkers)));
 
-			StartParallelLoopForRange(NumPartitions, 64); // Too low maybe?
 			return;
 		}
 
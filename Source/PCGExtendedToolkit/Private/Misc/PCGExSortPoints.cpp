@@ -4,6 +4,8 @@
 
 #include "Misc/PCGExSortPoints.h"
 
+#include "Algo/StableSort.h"
+
 #define LOCTEXT_NAMESPACE "PCGExSortPoints"
 #define PCGEX_NAMESPACE SortPoints
 
@@ -70,6 +72,55 @@ bool FPCGExSortPointsBaseElement::ExecuteInternal(FPCGContext* InContext) const
 
 namespace PCGExSortPoints
 {
+	void RadixSort(TArray<int32>& Order, const TArray<uint64>& Keys)
+	{
+		const int32 NumItems = Order.Num();
+		if (NumItems < 2) { return; }
+
+		TArray<int32> Buffer;
+		PCGEX_SET_NUM_UNINITIALIZED(Buffer, NumItems)
+
+		// Build all digit histograms in a single pass
+		TArray<int32> Histograms;
+		Histograms.SetNumZeroed(8 * 256);
+
+		for (const int32 Index : Order)
+		{
+			const uint64 Key = Keys[Index];
+			for (int32 Pass = 0; Pass < 8; ++Pass) { Histograms[Pass * 256 + ((Key >> (Pass * 8)) & 0xFF)]++; }
+		}
+
+		int32* Src = Order.GetData();
+		int32* Dst = Buffer.GetData();
+
+		for (int32 Pass = 0; Pass < 8; ++Pass)
+		{
+			int32* Histogram = Histograms.GetData() + Pass * 256;
+			const int32 Shift = Pass * 8;
+
+			// All keys share this digit, nothing to reorder
+			if (Histogram[(Keys[Src[0]] >> Shift) & 0xFF] == NumItems) { continue; }
+
+			int32 Offset = 0;
+			for (int32 i = 0; i < 256; ++i)
+			{
+				const int32 Count = Histogram[i];
+				Histogram[i] = Offset;
+				Offset += Count;
+			}
+
+			for (int32 i = 0; i < NumItems; ++i)
+			{
+				const int32 Index = Src[i];
+				Dst[Histogram[(Keys[Index] >> Shift) & 0xFF]++] = Index;
+			}
+
+			Swap(Src, Dst);
+		}
+
+		if (Src != Order.GetData()) { FMemory::Memcpy(Order.GetData(), Src, NumItems * sizeof(int32)); }
+	}
+
 	bool FProcessor::Process(PCGExMT::FTaskManager* AsyncManager)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSortPoints::Process);
@@ -77,15 +128,13 @@ namespace PCGExSortPoints
 
 		if (!FPointsProcessor::Process(AsyncManager)) { return false; }
 
+		LocalSettings = Settings;
+
 		TArray<FPCGExSortRuleConfig> RuleConfigs;
 		Settings->GetSortingRules(Context, RuleConfigs);
 
-		TArray<FPCGExSortRule*> Rules;
 		Rules.Reserve(RuleConfigs.Num());
 
-		TMap<PCGMetadataEntryKey, int32> PointIndices;
-		PointIO->PrintOutKeysMap(PointIndices, true);
-
 		for (const FPCGExSortRuleConfig& RuleConfig : RuleConfigs)
 		{
 			FPCGExSortRule* NewRule = new FPCGExSortRule();
@@ -107,37 +156,183 @@ namespace PCGExSortPoints
 		if (Rules.IsEmpty())
 		{
 			// Don't sort
-			PointIndices.Empty();
 			return false;
 		}
 
-		auto SortPredicate = [&](const FPCGPoint& A, const FPCGPoint& B)
+		UPCGPointData* OutData = PointIO->GetOut();
+		TArray<FPCGPoint>& MutablePoints = OutData->GetMutablePoints();
+		for (FPCGPoint& Point : MutablePoints) { OutData->Metadata->InitializeOnSet(Point.MetadataEntry); }
+
+		// Sort indices rather than points; cached values are indexed by original point index.
+		const int32 NumPoints = MutablePoints.Num();
+		PCGEX_SET_NUM_UNINITIALIZED(Order, NumPoints)
+		for (int i = 0; i < NumPoints; ++i) { Order[i] = i; }
+
+		if (Rules.Num() == 1)
 		{
-			int Result = 0;
-			for (const FPCGExSortRule* Rule : Rules)
+			// Single key : radix sort over order-preserving keys.
+			// Tolerance is ignored here; an exact order is a valid refinement of a tolerance-equal one.
+			const FPCGExSortRule* Rule = Rules[0];
+			const bool bFlip = Rule->bInvertRule != (Settings->SortDirection == EPCGExSortDirection::Descending);
+
+			TArray<uint64> Keys;
+			PCGEX_SET_NUM_UNINITIALIZED(Keys, NumPoints)
+			for (int i = 0; i < NumPoints; ++i)
 			{
-				const double ValueA = Rule->Cache->Values[PointIndices[A.MetadataEntry]];
-				const double ValueB = Rule->Cache->Values[PointIndices[B.MetadataEntry]];
-				Result = FMath::IsNearlyEqual(ValueA, ValueB, Rule->Tolerance) ? 0 : ValueA < ValueB ? -1 : 1;
-				if (Result != 0)
-				{
-					if (Rule->bInvertRule) { Result *= -1; }
-					break;
-				}
+				const uint64 Key = GetRadixKey(Rule->Cache->Values[i]);
+				Keys[i] = bFlip ? ~Key : Key;
 			}
 
-			if (Settings->SortDirection == EPCGExSortDirection::Descending) { Result *= -1; }
-			return Result < 0;
-		};
+			RadixSort(Order, Keys);
+			StartGather();
+			return true;
+		}
+
+		if (NumPoints <= GetDefault<UPCGExGlobalSettings>()->SmallPointsSize)
+		{
+			Order.StableSort([&](const int32 A, const int32 B) { return Compare(A, B); });
+			StartGather();
+			return true;
+		}
 
-		PointIO->GetOut()->GetMutablePoints().Sort(SortPredicate);
+		// Multiple keys : sort chunks in parallel, then merge sorted runs.
+		SortChunkSize = GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize();
+
+		PCGEX_ASYNC_GROUP(AsyncManagerPtr, SortChunksTask)
+		SortChunksTask->SetOnCompleteCallback(
+			[&]()
+			{
+				MergeWidth = SortChunkSize;
+				StartMergePass();
+			});
+
+		SortChunksTask->SetOnIterationRangeStartCallback(
+			[&](const int32 StartIndex, const int32 Count, const int32 LoopIdx)
+			{
+				TArrayView<int32> Chunk = MakeArrayView(Order.GetData() + StartIndex, Count);
+				Algo::StableSort(Chunk, [&](const int32 A, const int32 B) { return Compare(A, B); });
+			});
 
-		PointIndices.Empty();
-		PCGEX_DELETE_TARRAY(Rules)
+		SortChunksTask->PrepareRangesOnly(NumPoints, SortChunkSize);
 
 		return true;
 	}
 
+	bool FProcessor::Compare(const int32 A, const int32 B) const
+	{
+		int Result = 0;
+		for (const FPCGExSortRule* Rule : Rules)
+		{
+			const double ValueA = Rule->Cache->Values[A];
+			const double ValueB = Rule->Cache->Values[B];
+			Result = FMath::IsNearlyEqual(ValueA, ValueB, Rule->Tolerance) ? 0 : ValueA < ValueB ? -1 : 1;
+			if (Result != 0)
+			{
+				if (Rule->bInvertRule) { Result *= -1; }
+				break;
+			}
+		}
+
+		if (LocalSettings->SortDirection == EPCGExSortDirection::Descending) { Result *= -1; }
+		return Result < 0;
+	}
+
+	void FProcessor::StartMergePass()
+	{
+		const int32 NumItems = Order.Num();
+
+		if (MergeWidth >= NumItems)
+		{
+			MergeBuffer.Empty();
+			StartGather();
+			return;
+		}
+
+		PCGEX_SET_NUM_UNINITIALIZED(MergeBuffer, NumItems)
+
+		// Each level is split into fixed-size output blocks rather than one task per pair,
+		// so the last levels (few, large pairs) stay parallel. Blocks never straddle a pair
+		// since pair bounds are multiples of 2 * Width >= 2 * SortChunkSize.
+		PCGEX_ASYNC_GROUP(AsyncManagerPtr, MergePassTask)
+		MergePassTask->SetOnCompleteCallback(
+			[&]()
+			{
+				Swap(Order, MergeBuffer);
+				MergeWidth *= 2;
+				StartMergePass();
+			});
+
+		MergePassTask->SetOnIterationRangeStartCallback(
+			[&](const int32 StartIndex, const int32 Count, const int32 LoopIdx) { MergeBlock(StartIndex, StartIndex + Count); });
+
+		MergePassTask->PrepareRangesOnly(NumItems, SortChunkSize);
+	}
+
+	void FProcessor::MergeBlock(const int32 OutStart, const int32 OutEnd)
+	{
+		const int32 NumItems = Order.Num();
+		const int32* Src = Order.GetData();
+		int32* Dst = MergeBuffer.GetData();
+
+		const int32 Left = (OutStart / (MergeWidth * 2)) * (MergeWidth * 2);
+		const int32 Mid = FMath::Min(Left + MergeWidth, NumItems);
+		const int32 Right = FMath::Min(Left + MergeWidth * 2, NumItems);
+
+		const int32* A = Src + Left;
+		const int32* B = Src + Mid;
+		const int32 NumA = Mid - Left;
+		const int32 NumB = Right - Mid;
+
+		// Number of items taken from A among the first K merged items (merge path).
+		// Ties favor A, matching the stable merge below.
+		auto CoRank = [&](const int32 K)
+		{
+			int32 Lo = FMath::Max(0, K - NumB);
+			int32 Hi = FMath::Min(K, NumA);
+			while (Lo < Hi)
+			{
+				const int32 I = (Lo + Hi) / 2;
+				const int32 J = K - I;
+				if (J > 0 && I < NumA && !Compare(B[J - 1], A[I])) { Lo = I + 1; }
+				else { Hi = I; }
+			}
+			return Lo;
+		};
+
+		int32 i = CoRank(OutStart - Left);
+		int32 j = (OutStart - Left) - i;
+		const int32 EndI = CoRank(OutEnd - Left);
+		const int32 EndJ = (OutEnd - Left) - EndI;
+
+		int32 k = OutStart;
+		while (i < EndI && j < EndJ) { Dst[k++] = Compare(B[j], A[i]) ? B[j++] : A[i++]; }
+		while (i < EndI) { Dst[k++] = A[i++]; }
+		while (j < EndJ) { Dst[k++] = B[j++]; }
+	}
+
+	void FProcessor::StartGather()
+	{
+		const int32 NumPoints = Order.Num();
+		PCGEX_SET_NUM_UNINITIALIZED(SortedPoints, NumPoints)
+
+		PCGEX_ASYNC_GROUP(AsyncManagerPtr, GatherTask)
+		GatherTask->SetOnCompleteCallback(
+			[&]()
+			{
+				PointIO->GetOut()->GetMutablePoints() = MoveTemp(SortedPoints);
+				Order.Empty();
+			});
+
+		GatherTask->SetOnIterationRangeStartCallback(
+			[&](const int32 StartIndex, const int32 Count, const int32 LoopIdx)
+			{
+				const TArray<FPCGPoint>& InPoints = PointIO->GetOut()->GetPoints();
+				for (int i = StartIndex; i < StartIndex + Count; ++i) { SortedPoints[i] = InPoints[Order[i]]; }
+			});
+
+		GatherTask->PrepareRangesOnly(NumPoints, GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize());
+	}
+
 	void FProcessor::CompleteWork()
 	{
 		FPointsProcessor::CompleteWork();
@@ -152,7 +152,7 @@ namespace PCGExUberFilter
 		FilterScope(StartIndex, Count);
 	}
 
-	void FProcessor::ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const int32 LoopIdx, const int32 LoopCount)
+	void FProcessor::ProcessSingleInPoint(const int32 Index, const FPCGPoint& Point, const int32 LoopIdx, const int32 LoopCount)
 	{
 		if (!Results) { return; }
 		Results->Values[Index] = LocalSettings->bSwap ? !PointFilterCache[Index] : PointFilterCache[Index];
@@ -135,7 +135,7 @@ namespace PCGExUberFilterCollections
 		FilterScope(StartIndex, Count);
 	}
 
-	void FProcessor::ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const int32 LoopIdx, const int32 LoopCount)
+	void FProcessor::ProcessSingleInPoint(const int32 Index, const FPCGPoint& Point, const int32 LoopIdx, const int32 LoopCount)
 	{
 		if (PointFilterCache[Index]) { FPlatformAtomics::InterlockedAdd(&NumInside, 1); }
 		else { FPlatformAtomics::InterlockedAdd(&NumOutside, 1); }
@@ -45,6 +45,7 @@ bool FPCGExWriteIndexElement::ExecuteInternal(FPCGContext* InContext) const
 			[&](PCGExData::FPointIO* Entry) { return true; },
 			[&](PCGExPointsMT::TBatch<PCGExWriteIndex::FProcessor>* NewBatch)
 			{
+				NewBatch->bPipelineProcessing = true;
 			},
 			PCGExMT::State_Done))
 		{
@@ -4,8 +4,307 @@
 
 #include "PCGExMT.h"
 
+#include "PCGSettings.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+TRACE_DECLARE_INT_COUNTER(PCGExTaskGroupChunks, TEXT("PCGEx/TaskGroups/Chunks"));
+TRACE_DECLARE_INT_COUNTER(PCGExTaskGroupItems, TEXT("PCGEx/TaskGroups/Items"));
+TRACE_DECLARE_FLOAT_COUNTER(PCGExTaskGroupBusyTime, TEXT("PCGEx/TaskGroups/BusyTime (ms)"));
+TRACE_DECLARE_FLOAT_COUNTER(PCGExTaskGroupWallTime, TEXT("PCGEx/TaskGroups/WallTime (ms)"));
+TRACE_DECLARE_FLOAT_COUNTER(PCGExTaskGroupMaxChunkTime, TEXT("PCGEx/TaskGroups/MaxChunkTime (ms)"));
+
 namespace PCGExMT
 {
+#pragma region Work stealing
+
+	void FWorkStealingDeque::Reset(const int32 InBegin, const int32 InEnd)
+	{
+		FWriteScopeLock WriteScopeLock(DequeLock);
+		Ranges.Reset();
+		Head = 0;
+		if (InEnd > InBegin) { Ranges.Add(PCGEx::H64(InBegin, InEnd)); }
+	}
+
+	void FWorkStealingDeque::Push(const int32 InBegin, const int32 InEnd)
+	{
+		FWriteScopeLock WriteScopeLock(DequeLock);
+		Ranges.Add(PCGEx::H64(InBegin, InEnd));
+	}
+
+	bool FWorkStealingDeque::Pop(int32& OutBegin, int32& OutEnd)
+	{
+		FWriteScopeLock WriteScopeLock(DequeLock);
+		if (Ranges.Num() <= Head) { return false; }
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION <= 3
+		const uint64 Range = Ranges.Pop(false);
+#else
+		const uint64 Range = Ranges.Pop(EAllowShrinking::No);
+#endif
+		OutBegin = PCGEx::H64A(Range);
+		OutEnd = PCGEx::H64B(Range);
+
+		if (Ranges.Num() <= Head)
+		{
+			Ranges.Reset();
+			Head = 0;
+		}
+
+		return true;
+	}
+
+	bool FWorkStealingDeque::Steal(int32& OutBegin, int32& OutEnd)
+	{
+		FWriteScopeLock WriteScopeLock(DequeLock);
+		if (Ranges.Num() <= Head) { return false; }
+
+		const uint64 Range = Ranges[Head++];
+		OutBegin = PCGEx::H64A(Range);
+		OutEnd = PCGEx::H64B(Range);
+
+		if (Ranges.Num() <= Head)
+		{
+			Ranges.Reset();
+			Head = 0;
+		}
+
+		return true;
+	}
+
+	FWorkStealingJob::~FWorkStealingJob()
+	{
+		Group = nullptr;
+		PCGEX_DELETE_TARRAY(Deques)
+	}
+
+	void FWorkStealingJob::Init(FTaskGroup* InGroup, const int32 InMaxItems, const int32 InChunkSize, const bool bInPrepareOnly, const int32 InNumWorkers)
+	{
+		Group = InGroup;
+		MaxItems = InMaxItems;
+		ChunkSize = FMath::Max(1, InChunkSize);
+		NumChunks = FMath::DivideAndRoundUp(MaxItems, ChunkSize);
+		NumWorkers = FMath::Clamp(InNumWorkers, 1, FMath::Max(1, NumChunks));
+		bPrepareOnly = bInPrepareOnly;
+
+		NumActiveWorkers.store(NumWorkers);
+
+		while (Deques.Num() < NumWorkers) { Deques.Add(new FWorkStealingDeque()); }
+
+		// Seed each worker with a contiguous slice of chunks; splitting happens lazily as they are consumed
+		for (int i = 0; i < NumWorkers; ++i)
+		{
+			Deques[i]->Reset(
+				static_cast<int32>(static_cast<int64>(NumChunks) * i / NumWorkers),
+				static_cast<int32>(static_cast<int64>(NumChunks) * (i + 1) / NumWorkers));
+		}
+	}
+
+	bool FWorkStealingJob::Next(const int32 WorkerIndex, int32& OutChunkIndex)
+	{
+		int32 Begin = 0;
+		int32 End = 0;
+
+		if (!Deques[WorkerIndex]->Pop(Begin, End))
+		{
+			bool bStolen = false;
+			for (int i = 1; i < NumWorkers; ++i)
+			{
+				if (Deques[(WorkerIndex + i) % NumWorkers]->Steal(Begin, End))
+				{
+					bStolen = true;
+					break;
+				}
+			}
+
+			if (!bStolen) { return false; }
+		}
+
+		// Split on demand : keep the lower half, expose the upper half to thieves
+		while (End - Begin > 1)
+		{
+			const int32 Mid = Begin + (End - Begin) / 2;
+			Deques[WorkerIndex]->Push(Mid, End);
+			End = Mid;
+		}
+
+		OutChunkIndex = Begin;
+		return true;
+	}
+
+	FChunkCostCache& FChunkCostCache::Get()
+	{
+		static FChunkCostCache Instance;
+		return Instance;
+	}
+
+	bool FChunkCostCache::GetCost(const uint32 Key, double& OutSecondsPerItem) const
+	{
+		FReadScopeLock ReadScopeLock(CacheLock);
+		if (const FCost* Cost = Costs.Find(Key))
+		{
+			OutSecondsPerItem = Cost->SecondsPerItem;
+			return true;
+		}
+		return false;
+	}
+
+	void FChunkCostCache::Record(const uint32 Key, const double SecondsPerItem)
+	{
+		FWriteScopeLock WriteScopeLock(CacheLock);
+
+		if (FCost* Cost = Costs.Find(Key))
+		{
+			Cost->SecondsPerItem = (Cost->SecondsPerItem + SecondsPerItem) * 0.5; // Smooth out outliers
+			Cost->LastRecord = ++RecordCounter;
+			return;
+		}
+
+		if (Costs.Num() >= MaxEntries) { EvictOldest(); }
+		Costs.Add(Key, FCost{SecondsPerItem, ++RecordCounter});
+	}
+
+	void FChunkCostCache::EvictOldest()
+	{
+		// Drop the older half at once so eviction stays amortized
+		TArray<uint64> Ages;
+		Ages.Reserve(Costs.Num());
+		for (const TPair<uint32, FCost>& Pair : Costs) { Ages.Add(Pair.Value.LastRecord); }
+		Ages.Sort();
+
+		const uint64 Threshold = Ages[Ages.Num() / 2];
+		for (auto It = Costs.CreateIterator(); It; ++It) { if (It.Value().LastRecord < Threshold) { It.RemoveCurrent(); } }
+	}
+
+	FWorkStealingJob* FTaskManager::AcquireJob()
+	{
+		FWriteScopeLock WriteLock(JobsLock);
+		if (!FreeJobs.IsEmpty()) { return FreeJobs.Pop(); }
+		return Jobs.Add_GetRef(new FWorkStealingJob());
+	}
+
+	void FTaskManager::ReleaseJob(FWorkStealingJob* InJob)
+	{
+		FWriteScopeLock WriteLock(JobsLock);
+		InJob->Group = nullptr;
+		FreeJobs.Add(InJob);
+	}
+
+#pragma endregion
+
+#pragma region Task graph
+
+	static thread_local FTaskGraphNode* GCurrentGraphNode = nullptr;
+
+	void FTaskGraphNode::Hold()
+	{
+		PendingWork.fetch_add(1);
+	}
+
+	void FTaskGraphNode::Release()
+	{
+		if (PendingWork.fetch_sub(1) == 1) { Graph->OnNodeCompleted(this); }
+	}
+
+	FTaskGraphNode* FTaskGraphNode::GetCurrent() { return GCurrentGraphNode; }
+
+	FTaskGraphScope::FTaskGraphScope(FTaskGraphNode* InNode)
+		: PreviousNode(GCurrentGraphNode)
+	{
+		GCurrentGraphNode = InNode;
+	}
+
+	FTaskGraphScope::~FTaskGraphScope()
+	{
+		GCurrentGraphNode = PreviousNode;
+	}
+
+	FTaskGraph::~FTaskGraph()
+	{
+		Manager = nullptr;
+		PCGEX_DELETE_TARRAY(Nodes)
+	}
+
+	FTaskGraphNode* FTaskGraph::Add(const FName InName, const FTaskGraphNode::WorkCallback& InWork)
+	{
+		FTaskGraphNode* NewNode = Nodes.Add_GetRef(new FTaskGraphNode(this, InName, InWork));
+		NumPending.fetch_add(1);
+		return NewNode;
+	}
+
+	void FTaskGraph::AddDependency(FTaskGraphNode* InNode, FTaskGraphNode* InDependsOn)
+	{
+		check(InNode->Graph == this && InDependsOn->Graph == this)
+		InDependsOn->Dependents.Add(InNode);
+		InNode->PendingDependencies.fetch_add(1);
+	}
+
+	void FTaskGraph::Start()
+	{
+		if (Nodes.IsEmpty())
+		{
+			if (bHasOnCompleteCallback) { OnCompleteCallback(); }
+			return;
+		}
+
+		// Gather roots first, as scheduling may complete stages synchronously
+		TArray<FTaskGraphNode*> Roots;
+		for (FTaskGraphNode* Node : Nodes) { if (Node->PendingDependencies.load() == 0) { Roots.Add(Node); } }
+
+		check(!Roots.IsEmpty()) // Cyclic graph
+
+		for (FTaskGraphNode* Root : Roots) { Schedule(Root); }
+	}
+
+	void FTaskGraph::Schedule(FTaskGraphNode* InNode)
+	{
+		if (!Manager->IsAvailable()) { return; }
+
+		InNode->PendingWork.store(1);
+
+		// The stage task must not be attributed to whichever stage is scheduling it
+		FTaskGraphScope NullScope(nullptr);
+		Manager->Start<FTaskGraphNodeTask>(-1, nullptr, InNode);
+	}
+
+	void FTaskGraph::OnNodeCompleted(FTaskGraphNode* InNode)
+	{
+		for (FTaskGraphNode* Dependent : InNode->Dependents)
+		{
+			if (Dependent->PendingDependencies.fetch_sub(1) == 1) { Schedule(Dependent); }
+		}
+
+		if (NumPending.fetch_sub(1) == 1 && bHasOnCompleteCallback) { OnCompleteCallback(); }
+	}
+
+#pragma endregion
+
+	uint32 FTaskManager::GetCostKey(const FName InGroupName) const
+	{
+		// Node pointers get recycled after GC; settings UID & CRC identify the node and its configuration instead
+		const UPCGSettings* Settings = Context ? Context->GetInputSettings<UPCGSettings>() : nullptr;
+		if (!Settings) { return GetTypeHash(InGroupName); }
+		return HashCombine(HashCombine(GetTypeHash(Settings->UID), Settings->GetSettingsCrc().GetValue()), GetTypeHash(InGroupName));
+	}
+
+	void FTaskManager::AppendStats(const FTaskGroupStats& InStats)
+	{
+		TRACE_COUNTER_ADD(PCGExTaskGroupChunks, InStats.NumChunks);
+		TRACE_COUNTER_ADD(PCGExTaskGroupItems, InStats.NumItems);
+		TRACE_COUNTER_SET(PCGExTaskGroupBusyTime, InStats.BusyTime * 1000);
+		TRACE_COUNTER_SET(PCGExTaskGroupWallTime, InStats.WallTime * 1000);
+		TRACE_COUNTER_SET(PCGExTaskGroupMaxChunkTime, InStats.MaxChunkTime * 1000);
+
+		FWriteScopeLock WriteLock(StatsLock);
+		if (FTaskGroupStats* Existing = GroupStats.Find(InStats.Name)) { Existing->Append(InStats); }
+		else { GroupStats.Add(InStats.Name, InStats); }
+	}
+
+	void FTaskManager::GetStats(TArray<FTaskGroupStats>& OutStats) const
+	{
+		FReadScopeLock ReadLock(StatsLock);
+		GroupStats.GenerateValueArray(OutStats);
+	}
+
 	FTaskManager::~FTaskManager()
 	{
 		FPlatformAtomics::InterlockedExchange(&Stopped, 1);
@@ -24,6 +323,18 @@ namespace PCGExMT
 		return NewGroup;
 	}
 
+	FTaskGraph* FTaskManager::CreateGraph(const FName& GraphName)
+	{
+		check(IsAvailable())
+
+		FTaskGraph* NewGraph = new FTaskGraph(this, GraphName);
+		{
+			FWriteScopeLock WriteLock(GroupLock);
+			Graphs.Add(NewGraph);
+		}
+		return NewGraph;
+	}
+
 	void FTaskManager::OnAsyncTaskExecutionComplete(FPCGExTask* AsyncTask, bool bSuccess)
 	{
 		if (Flushing) { return; }
@@ -54,7 +365,24 @@ namespace PCGExMT
 		NumStarted = 0;
 		NumCompleted = 0;
 
+		{
+			FWriteScopeLock WriteJobsLock(JobsLock);
+			FreeJobs.Empty();
+			PCGEX_DELETE_TARRAY(Jobs)
+		}
+
 		PCGEX_DELETE_TARRAY(Groups)
+		PCGEX_DELETE_TARRAY(Graphs)
+	}
+
+	void FTaskGroup::SetAdaptiveChunkSize(const bool bEnabled)
+	{
+		bAdaptiveChunkSize = bEnabled && Manager->bAdaptiveChunkSize && !Manager->ForceSync;
+		if (bAdaptiveChunkSize)
+		{
+			bMeasureChunks = true;
+			CostKey = Manager->GetCostKey(GroupName);
+		}
 	}
 
 	void FTaskGroup::StartRanges(const IterationCallback& Callback, const int32 MaxItems, const int32 ChunkSize, const bool bInlined, const bool bExecuteSmallSynchronously)
@@ -62,8 +390,9 @@ namespace PCGExMT
 		if (!Manager->IsAvailable()) { return; }
 
 		OnIterationCallback = Callback;
+		MarkStarted();
 
-		const int32 SanitizedChunkSize = FMath::Max(1, ChunkSize);
+		const int32 SanitizedChunkSize = bInlined ? FMath::Max(1, ChunkSize) : GetAdaptiveChunkSize(MaxItems, ChunkSize);
 
 		if (MaxItems <= SanitizedChunkSize && bExecuteSmallSynchronously)
 		{
@@ -81,6 +410,15 @@ namespace PCGExMT
 			if (bHasOnIterationRangePrepareCallback) { OnIterationRangePrepareCallback(Loops); }
 			InternalStartInlineRange<FGroupRangeInlineIterationTask>(0, MaxItems, SanitizedChunkSize);
 		}
+		else if (Manager->UseWorkStealing())
+		{
+			// Stealing already balances the load; adaptive sizing only picks the chunk size it splits down to
+			InternalStartStealingRanges(MaxItems, SanitizedChunkSize, false);
+		}
+		else if (bAdaptiveChunkSize)
+		{
+			InternalStartAdaptiveRanges(MaxItems, SanitizedChunkSize, false);
+		}
 		else
 		{
 			StartRanges<FGroupRangeIterationTask>(MaxItems, SanitizedChunkSize, nullptr);
@@ -91,7 +429,9 @@ namespace PCGExMT
 	{
 		if (!Manager->IsAvailable()) { return; }
 
-		const int32 SanitizedChunkSize = FMath::Max(1, ChunkSize);
+		MarkStarted();
+
+		const int32 SanitizedChunkSize = bInline ? FMath::Max(1, ChunkSize) : GetAdaptiveChunkSize(MaxItems, ChunkSize);
 
 		if (bInline)
 		{
@@ -100,20 +440,143 @@ namespace PCGExMT
 			if (bHasOnIterationRangePrepareCallback) { OnIterationRangePrepareCallback(Loops); }
 			InternalStartInlineRange<FGroupPrepareRangeInlineTask>(0, MaxItems, SanitizedChunkSize);
 		}
+		else if (Manager->UseWorkStealing()) { InternalStartStealingRanges(MaxItems, SanitizedChunkSize, true); } // See StartRanges
+		else if (bAdaptiveChunkSize) { InternalStartAdaptiveRanges(MaxItems, SanitizedChunkSize, true); }
 		else { StartRanges<FGroupPrepareRangeTask>(MaxItems, SanitizedChunkSize, nullptr); }
 	}
 
+	int32 FTaskGroup::GetAdaptiveChunkSize(const int32 MaxItems, const int32 ChunkSize) const
+	{
+		const int32 SanitizedChunkSize = FMath::Max(1, ChunkSize);
+		if (!bAdaptiveChunkSize) { return SanitizedChunkSize; }
+
+		double SecondsPerItem = 0;
+		if (!FChunkCostCache::Get().GetCost(CostKey, SecondsPerItem) || SecondsPerItem <= 0) { return SanitizedChunkSize; }
+
+		// Known cost from a previous execution : size chunks toward the target duration,
+		// but keep at least one chunk per worker so the loop still spreads over all cores.
+		// With work stealing, this is the granularity stealing splits down to.
+		const int32 NumWorkers = FMath::Max(1, GThreadPool ? GThreadPool->GetNumThreads() : 1);
+		const int32 IdealChunkSize = static_cast<int32>(FMath::Min(Manager->AdaptiveTargetSeconds / SecondsPerItem, static_cast<double>(MAX_int32)));
+		return FMath::Clamp(IdealChunkSize, 1, FMath::Max(1, MaxItems / NumWorkers));
+	}
+
+	int32 FTaskGroup::GetAdaptiveGrab(const int32 Remaining) const
+	{
+		const int32 NumMeasured = MeasuredChunks.load();
+		if (NumMeasured <= 0) { return 1; } // First chunks are timed one at a time
+
+		const double AverageSeconds = FPlatformTime::ToSeconds64(MeasuredCycles.load()) / NumMeasured;
+		const int32 IdealGrab = AverageSeconds > 0 ? static_cast<int32>(FMath::Min(Manager->AdaptiveTargetSeconds / AverageSeconds, static_cast<double>(MAX_int32))) : Remaining;
+
+		// Guided : never grab more than half an even share of what's left, to preserve balance
+		return FMath::Clamp(IdealGrab, 1, FMath::Max(1, Remaining / (2 * AdaptiveNumWorkers)));
+	}
+
+	void FTaskGroup::MarkStarted()
+	{
+		if (!bMeasureChunks) { return; }
+		uint64 Expected = 0;
+		WallStartCycles.compare_exchange_strong(Expected, FPlatformTime::Cycles64());
+	}
+
+	void FTaskGroup::RecordChunk(const uint64 Cycles, const int32 Count) const
+	{
+		MeasuredCycles.fetch_add(Cycles);
+		MeasuredItems.fetch_add(Count);
+		MeasuredChunks.fetch_add(1);
+
+		uint64 PreviousMax = MaxChunkCycles.load();
+		while (PreviousMax < Cycles && !MaxChunkCycles.compare_exchange_weak(PreviousMax, Cycles))
+		{
+		}
+	}
+
+	void FTaskGroup::CommitMeasurements()
+	{
+		const uint64 EndCycles = FPlatformTime::Cycles64();
+		const uint64 StartCycles = WallStartCycles.exchange(0);
+		const int64 NumItems = MeasuredItems.exchange(0);
+		const uint64 Cycles = MeasuredCycles.exchange(0);
+		const uint64 MaxCycles = MaxChunkCycles.exchange(0);
+		const int32 NumChunks = MeasuredChunks.exchange(0);
+
+		if (bAdaptiveChunkSize && NumItems > 0)
+		{
+			FChunkCostCache::Get().Record(CostKey, FPlatformTime::ToSeconds64(Cycles) / static_cast<double>(NumItems));
+		}
+
+		if (!Manager->bTrackStats) { return; }
+
+		FTaskGroupStats Stats;
+		Stats.Name = GroupName;
+		Stats.NumGroups = 1;
+		Stats.WallTime = StartCycles > 0 && EndCycles > StartCycles ? FPlatformTime::ToSeconds64(EndCycles - StartCycles) : 0;
+		Stats.BusyTime = FPlatformTime::ToSeconds64(Cycles);
+		Stats.NumChunks = NumChunks;
+		Stats.NumItems = NumItems;
+		Stats.MaxChunkTime = FPlatformTime::ToSeconds64(MaxCycles);
+
+		Manager->AppendStats(Stats);
+	}
+
+	void FTaskGroup::InternalStartAdaptiveRanges(const int32 MaxItems, const int32 ChunkSize, const bool bPrepareOnly)
+	{
+		TArray<uint64> Loops;
+		FPlatformAtomics::InterlockedAdd(&NumStarted, SubRanges(Loops, MaxItems, ChunkSize));
+		if (bHasOnIterationRangePrepareCallback) { OnIterationRangePrepareCallback(Loops); }
+
+		AdaptiveMaxItems = MaxItems;
+		AdaptiveChunkSize = ChunkSize;
+		AdaptiveNumChunks = Loops.Num();
+		AdaptiveNumWorkers = FMath::Clamp(GThreadPool ? GThreadPool->GetNumThreads() : 1, 1, AdaptiveNumChunks);
+		bAdaptivePrepareOnly = bPrepareOnly;
+		AdaptiveCursor.store(0);
+
+		// Workers pull consecutive chunks from a shared cursor; how many they grab at once grows with measured cost
+		for (int i = 0; i < AdaptiveNumWorkers; ++i) { Manager->Start<FGroupAdaptiveRangeTask>(i, nullptr, this); }
+	}
+
+	void FTaskGroup::InternalStartStealingRanges(const int32 MaxItems, const int32 ChunkSize, const bool bPrepareOnly)
+	{
+		TArray<uint64> Loops;
+		FPlatformAtomics::InterlockedAdd(&NumStarted, SubRanges(Loops, MaxItems, ChunkSize));
+		if (bHasOnIterationRangePrepareCallback) { OnIterationRangePrepareCallback(Loops); }
+
+		FWorkStealingJob* Job = Manager->AcquireJob();
+		Job->Init(this, MaxItems, ChunkSize, bPrepareOnly, GThreadPool ? GThreadPool->GetNumThreads() : 1);
+
+		// One task per worker rather than one per chunk
+		const int32 NumWorkers = Job->GetNumWorkers();
+		for (int i = 0; i < NumWorkers; ++i) { Manager->Start<FWorkStealingTask>(i, nullptr, Job); }
+	}
+
 	void FTaskGroup::PrepareRangeIteration(const int32 StartIndex, const int32 Count, const int32 LoopIdx) const
 	{
 		if (!Manager->IsAvailable()) { return; }
-		if (bHasOnIterationRangeStartCallback) { OnIterationRangeStartCallback(StartIndex, Count, LoopIdx); }
+		if (!bHasOnIterationRangeStartCallback) { return; }
+
+		if (!bMeasureChunks)
+		{
+			OnIterationRangeStartCallback(StartIndex, Count, LoopIdx);
+			return;
+		}
+
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+		OnIterationRangeStartCallback(StartIndex, Count, LoopIdx);
+		RecordChunk(FPlatformTime::Cycles64() - StartCycles, Count);
 	}
 
 	void FTaskGroup::DoRangeIteration(const int32 StartIndex, const int32 Count, const int32 LoopIdx) const
 	{
 		if (!Manager->IsAvailable()) { return; }
-		PrepareRangeIteration(StartIndex, Count, LoopIdx);
+
+		const uint64 StartCycles = bMeasureChunks ? FPlatformTime::Cycles64() : 0;
+
+		if (bHasOnIterationRangeStartCallback) { OnIterationRangeStartCallback(StartIndex, Count, LoopIdx); }
 		for (int i = 0; i < Count; ++i) { OnIterationCallback(StartIndex + i, Count, LoopIdx); }
+
+		if (bMeasureChunks) { RecordChunk(FPlatformTime::Cycles64() - StartCycles, Count); }
 	}
 
 	void FTaskGroup::OnTaskCompleted()
@@ -129,6 +592,7 @@ namespace PCGExMT
 			{
 				NumCompleted = 0;
 				NumStarted = 0;
+				if (bMeasureChunks) { CommitMeasurements(); }
 				if (bHasOnCompleteCallback) { OnCompleteCallback(); }
 			}
 		}
@@ -148,6 +612,74 @@ namespace PCGExMT
 		return true;
 	}
 
+	bool FWorkStealingTask::ExecuteTask()
+	{
+		check(Job)
+
+		FTaskGroup* JobGroup = Job->Group;
+		int32 ChunkIndex = -1;
+
+		while (Checkpoint() && Job->Next(TaskIndex, ChunkIndex))
+		{
+			const int32 StartIndex = ChunkIndex * Job->ChunkSize;
+			const int32 Count = FMath::Min(Job->ChunkSize, Job->MaxItems - StartIndex);
+
+			if (Job->bPrepareOnly) { JobGroup->PrepareRangeIteration(StartIndex, Count, ChunkIndex); }
+			else { JobGroup->DoRangeIteration(StartIndex, Count, ChunkIndex); }
+
+			JobGroup->OnTaskCompleted();
+		}
+
+		// Last worker out hands the job back to the pool
+		if (Job->NumActiveWorkers.fetch_sub(1) == 1) { Manager->ReleaseJob(Job); }
+		Job = nullptr;
+
+		return true;
+	}
+
+	bool FGroupAdaptiveRangeTask::ExecuteTask()
+	{
+		check(RangeGroup)
+
+		while (Checkpoint())
+		{
+			const int32 Grab = RangeGroup->GetAdaptiveGrab(RangeGroup->AdaptiveNumChunks - RangeGroup->AdaptiveCursor.load());
+			const int32 FirstChunk = RangeGroup->AdaptiveCursor.fetch_add(Grab);
+			if (FirstChunk >= RangeGroup->AdaptiveNumChunks) { break; }
+
+			const int32 LastChunk = FMath::Min(FirstChunk + Grab, RangeGroup->AdaptiveNumChunks);
+			for (int32 ChunkIndex = FirstChunk; ChunkIndex < LastChunk; ++ChunkIndex)
+			{
+				const int32 StartIndex = ChunkIndex * RangeGroup->AdaptiveChunkSize;
+				const int32 Count = FMath::Min(RangeGroup->AdaptiveChunkSize, RangeGroup->AdaptiveMaxItems - StartIndex);
+
+				if (RangeGroup->bAdaptivePrepareOnly) { RangeGroup->PrepareRangeIteration(StartIndex, Count, ChunkIndex); }
+				else { RangeGroup->DoRangeIteration(StartIndex, Count, ChunkIndex); }
+
+				RangeGroup->OnTaskCompleted();
+			}
+		}
+
+		RangeGroup = nullptr;
+		return true;
+	}
+
+	bool FTaskGraphNodeTask::ExecuteTask()
+	{
+		check(Node)
+
+		{
+			FTaskGraphScope GraphScope(Node);
+			Node->Work();
+		}
+
+		// Release the stage's own hold; it completes once whatever it started is done as well
+		Node->Release();
+		Node = nullptr;
+
+		return true;
+	}
+
 	bool FGroupPrepareRangeInlineTask::ExecuteTask()
 	{
 		check(Group)
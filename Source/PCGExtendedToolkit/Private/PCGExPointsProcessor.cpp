@@ -4,6 +4,7 @@
 #include "PCGExPointsProcessor.h"
 
 #include "PCGPin.h"
+#include "PCGParamData.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExPointFilter.h"
 #include "Helpers/PCGSettingsHelpers.h"
@@ -107,6 +108,7 @@ TArray<FPCGPinProperties> UPCGExPointsProcessorSettings::OutputPinProperties() c
 {
 	TArray<FPCGPinProperties> PinProperties;
 	PCGEX_PIN_POINTS(GetMainOutputLabel(), "The processed points.", Required, {})
+	if (bOutputTaskStats) { PCGEX_PIN_PARAMS(PCGExMT::OutputTaskStatsLabel, "Per task-group timings, one entry per group name.", Advanced, {}) }
 	return PinProperties;
 }
 
@@ -155,6 +157,44 @@ bool FPCGExPointsProcessorContext::AdvancePointsIO(const bool bCleanupKeys)
 
 bool FPCGExPointsProcessorContext::ExecuteAutomation() { return true; }
 
+void FPCGExPointsProcessorContext::OnComplete()
+{
+	if (bOutputTaskStats && AsyncManager)
+	{
+		TArray<PCGExMT::FTaskGroupStats> Stats;
+		AsyncManager->GetStats(Stats);
+		Stats.Sort([](const PCGExMT::FTaskGroupStats& A, const PCGExMT::FTaskGroupStats& B) { return A.BusyTime > B.BusyTime; });
+
+		PCGEX_NEW_TRANSIENT(UPCGParamData, StatsData)
+
+		FPCGMetadataAttribute<FName>* NameAttribute = StatsData->Metadata->CreateAttribute<FName>(FName("Group"), NAME_None, false, true);
+		FPCGMetadataAttribute<int32>* NumGroupsAttribute = StatsData->Metadata->CreateAttribute<int32>(FName("NumGroups"), 0, false, true);
+		FPCGMetadataAttribute<double>* WallTimeAttribute = StatsData->Metadata->CreateAttribute<double>(FName("WallTimeMs"), 0, false, true);
+		FPCGMetadataAttribute<double>* BusyTimeAttribute = StatsData->Metadata->CreateAttribute<double>(FName("BusyTimeMs"), 0, false, true);
+		FPCGMetadataAttribute<int64>* NumChunksAttribute = StatsData->Metadata->CreateAttribute<int64>(FName("NumChunks"), 0, false, true);
+		FPCGMetadataAttribute<int64>* NumItemsAttribute = StatsData->Metadata->CreateAttribute<int64>(FName("NumItems"), 0, false, true);
+		FPCGMetadataAttribute<double>* MaxChunkTimeAttribute = StatsData->Metadata->CreateAttribute<double>(FName("MaxChunkTimeMs"), 0, false, true);
+		FPCGMetadataAttribute<double>* AvgChunkTimeAttribute = StatsData->Metadata->CreateAttribute<double>(FName("AvgChunkTimeMs"), 0, false, true);
+
+		for (const PCGExMT::FTaskGroupStats& GroupStats : Stats)
+		{
+			const int64 Key = StatsData->Metadata->AddEntry();
+			NameAttribute->SetValue(Key, GroupStats.Name);
+			NumGroupsAttribute->SetValue(Key, GroupStats.NumGroups);
+			WallTimeAttribute->SetValue(Key, GroupStats.WallTime * 1000);
+			BusyTimeAttribute->SetValue(Key, GroupStats.BusyTime * 1000);
+			NumChunksAttribute->SetValue(Key, GroupStats.NumChunks);
+			NumItemsAttribute->SetValue(Key, GroupStats.NumItems);
+			MaxChunkTimeAttribute->SetValue(Key, GroupStats.MaxChunkTime * 1000);
+			AvgChunkTimeAttribute->SetValue(Key, GroupStats.GetAverageChunkTime() * 1000);
+		}
+
+		FutureRootedOutput(PCGExMT::OutputTaskStatsLabel, StatsData, {});
+	}
+
+	FPCGExContext::OnComplete();
+}
+
 bool FPCGExPointsProcessorContext::TryComplete(const bool bForce)
 {
 	if (!bForce && !IsDone()) { return false; }
@@ -173,6 +213,19 @@ bool FPCGExPointsProcessorContext::ProcessPointsBatch()
 		if (!IsAsyncWorkComplete()) { return false; }
 
 		MTState_PointsProcessingDone();
+
+		if (MainBatch->bPipelineProcessing)
+		{
+			// Every processor already went through all its steps
+			MTState_PointsCompletingWorkDone();
+			if (MainBatch->bRequiresWriteStep) { MTState_PointsWritingDone(); }
+
+			if (TargetState_PointsProcessingDone == PCGExMT::State_Done) { Done(); }
+			else { SetState(TargetState_PointsProcessingDone); }
+
+			return true;
+		}
+
 		MainBatch->CompleteWork();
 		SetAsyncState(PCGExPointsMT::MTState_PointsCompletingWork);
 	}
@@ -216,6 +269,10 @@ PCGExMT::FTaskManager* FPCGExPointsProcessorContext::GetAsyncManager()
 		AsyncManager = new PCGExMT::FTaskManager();
 		AsyncManager->ForceSync = !bDoAsyncProcessing;
 		AsyncManager->Context = this;
+		AsyncManager->Scheduler = GetDefault<UPCGExGlobalSettings>()->TaskScheduler;
+		AsyncManager->bAdaptiveChunkSize = GetDefault<UPCGExGlobalSettings>()->bAdaptiveChunkSize;
+		AsyncManager->AdaptiveTargetSeconds = GetDefault<UPCGExGlobalSettings>()->AdaptiveChunkTargetDuration * 0.000001;
+		AsyncManager->bTrackStats = bOutputTaskStats;
 
 		PCGEX_SETTINGS_LOCAL(PointsProcessor)
 		PCGExMT::SetWorkPriority(Settings->WorkPriority, AsyncManager->WorkPriority);
@@ -304,6 +361,7 @@ FPCGContext* FPCGExPointsProcessorElement::InitializeContext(
 	check(Settings);
 
 	InContext->bFlattenOutput = Settings->bFlattenOutput;
+	InContext->bOutputTaskStats = Settings->bOutputTaskStats;
 
 	InContext->SetState(PCGExMT::State_Setup);
 	InContext->bDoAsyncProcessing = Settings->bDoAsyncProcessing;
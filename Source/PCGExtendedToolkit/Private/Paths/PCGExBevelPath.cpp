@@ -371,7 +371,7 @@ namespace PCGExBevelPath
 		return true;
 	}
 
-	void FProcessor::ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const int32 LoopIdx, const int32 LoopCount)
+	void FProcessor::ProcessSingleInPoint(const int32 Index, const FPCGPoint& Point, const int32 LoopIdx, const int32 LoopCount)
 	{
 		FBevel* Bevel = Bevels[Index];
 		if (!Bevel) { return; }
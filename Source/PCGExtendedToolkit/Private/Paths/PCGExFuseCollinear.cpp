@@ -118,7 +118,7 @@ namespace PCGExFuseCollinear
 		FilterScope(StartIndex, Count);
 	}
 
-	void FProcessor::ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const int32 LoopIdx, const int32 LoopCount)
+	void FProcessor::ProcessSingleInPoint(const int32 Index, const FPCGPoint& Point, const int32 LoopIdx, const int32 LoopCount)
 	{
 		if (Index == 0 || Index == MaxIndex) { return; }
 
@@ -269,7 +269,7 @@ namespace PCGExPathToClusters
 		return true;
 	}
 
-	void FFusingProcessor::ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const int32 LoopIdx, const int32 LoopCount)
+	void FFusingProcessor::ProcessSingleInPoint(const int32 Index, const FPCGPoint& Point, const int32 LoopIdx, const int32 LoopCount)
 	{
 		const int32 NextIndex = Index + 1;
 		if (NextIndex > LastIndex)
@@ -170,8 +170,9 @@ namespace PCGExSampleInsideBoundss
 			if (!RangeMaxGetter) { PCGE_LOG_C(Warning, GraphAndLog, Context, FTEXT("RangeMax metadata missing")); }
 		}
 
-		bSingleSample = LocalSettings->SampleMethod != EPCGExSampleMethod::WithinRange;
+		bSingleSample = LocalSettings->SampleMethod == EPCGExSampleMethod::ClosestTarget || LocalSettings->SampleMethod == EPCGExSampleMethod::FarthestTarget;
 
+		PointsProcessingOrder = Settings->ProcessingOrder;
 		StartParallelLoopForPoints();
 
 		return true;
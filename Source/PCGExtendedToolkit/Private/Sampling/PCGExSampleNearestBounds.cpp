@@ -160,6 +160,8 @@ namespace PCGExSampleNearestBounds
 		bSingleSample = LocalSettings->SampleMethod != EPCGExBoundsSampleMethod::WithinRange;
 
 		Cloud = LocalTypedContext->BoundsFacade->GetCloud(Settings->BoundsSource);
+
+		PointsProcessingOrder = Settings->ProcessingOrder;
 		StartParallelLoopForPoints();
 
 		return true;
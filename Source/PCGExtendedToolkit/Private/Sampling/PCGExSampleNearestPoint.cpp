@@ -37,6 +37,7 @@ FPCGExSampleNearestPointContext::~FPCGExSampleNearestPointContext()
 	PCGEX_TERMINATE_ASYNC
 
 	PCGEX_CLEAN_SP(WeightCurve)
+	PCGExData::FSpatialIndexCache::Get().Release(TargetKDTree);
 	PCGEX_DELETE_FACADE_AND_SOURCE(TargetsFacade)
 }
 
@@ -75,7 +76,15 @@ bool FPCGExSampleNearestPointElement::Boot(FPCGExContext* InContext) const
 	Context->TargetPoints = &Context->TargetsFacade->Source->GetIn()->GetPoints();
 	Context->NumTargets = Context->TargetPoints->Num();
 
+	// Positions are only read for center-to-center distances & K-nearest range filtering
+	if (Settings->SampleMethod == EPCGExSampleMethod::KNearest ||
+		(Settings->DistanceDetails.Source == EPCGExDistance::Center && Settings->DistanceDetails.Target == EPCGExDistance::Center))
+	{
+		Context->TargetPositions = Context->TargetsFacade->GetPositions();
+	}
+
 	Context->TargetOctree = &Context->TargetsFacade->Source->GetIn()->GetOctree();
+	if (Settings->SampleMethod == EPCGExSampleMethod::KNearest) { Context->TargetKDTree = PCGExData::FSpatialIndexCache::Get().AcquireKDTree(Context->TargetsFacade->Source->GetIn()); }
 
 	return true;
 }
@@ -96,6 +105,7 @@ bool FPCGExSampleNearestPointElement::ExecuteInternal(FPCGContext* InContext) co
 			[&](PCGExData::FPointIO* Entry) { return true; },
 			[&](PCGExPointsMT::TBatch<PCGExSampleNearestPoints::FProcessor>* NewBatch)
 			{
+				NewBatch->bPipelineProcessing = true;
 			},
 			PCGExMT::State_Done))
 		{
@@ -170,8 +180,10 @@ namespace PCGExSampleNearestPoints
 			if (!RangeMaxGetter) { PCGE_LOG_C(Warning, GraphAndLog, Context, FTEXT("RangeMax metadata missing")); }
 		}
 
-		bSingleSample = LocalSettings->SampleMethod != EPCGExSampleMethod::WithinRange;
+		bSingleSample = LocalSettings->SampleMethod == EPCGExSampleMethod::ClosestTarget || LocalSettings->SampleMethod == EPCGExSampleMethod::FarthestTarget;
+		bCenterToCenter = LocalSettings->DistanceDetails.Source == EPCGExDistance::Center && LocalSettings->DistanceDetails.Target == EPCGExDistance::Center;
 
+		PointsProcessingOrder = Settings->ProcessingOrder;
 		StartParallelLoopForPoints();
 
 		return true;
@@ -203,17 +215,8 @@ namespace PCGExSampleNearestPoints
 
 
 		PCGExNearestPoint::FTargetsCompoundInfos TargetsCompoundInfos;
-		auto SampleTarget = [&](const int32 PointIndex, const FPCGPoint& Target)
+		auto RegisterTarget = [&](const int32 PointIndex, const double Dist)
 		{
-			//if (Context->ValueFilterManager && !Context->ValueFilterManager->Results[PointIndex]) { return; } // TODO : Implement
-
-			FVector A;
-			FVector B;
-
-			LocalSettings->DistanceDetails.GetCenters(Point, Target, A, B);
-
-			const double Dist = FVector::DistSquared(A, B);
-
 			if (RangeMax > 0 && (Dist < RangeMin || Dist > RangeMax)) { return; }
 
 			if (bSingleSample)
@@ -227,13 +230,41 @@ namespace PCGExSampleNearestPoints
 			}
 		};
 
-		if (RangeMax > 0)
+		auto SampleTarget = [&](const int32 PointIndex, const FPCGPoint& Target)
+		{
+			//if (Context->ValueFilterManager && !Context->ValueFilterManager->Results[PointIndex]) { return; } // TODO : Implement
+
+			FVector A;
+			FVector B;
+
+			LocalSettings->DistanceDetails.GetCenters(Point, Target, A, B);
+			RegisterTarget(PointIndex, FVector::DistSquared(A, B));
+		};
+
+		if (LocalSettings->SampleMethod == EPCGExSampleMethod::KNearest)
+		{
+			// Bounded max-heap over the target KD-tree : only the K closest centers within range are visited
+			TArray<int32> Nearest;
+			LocalTypedContext->TargetKDTree->FindKNearest(
+				SourceCenter, LocalSettings->NumNearest, Nearest,
+				[&](const int32 PointIndex) { return RangeMax <= 0 || FVector::DistSquared(SourceCenter, (*LocalTypedContext->TargetPositions)[PointIndex]) >= RangeMin; },
+				RangeMax > 0 ? RangeMax + UE_SMALL_NUMBER : TNumericLimits<double>::Max());
+
+			TargetsInfos.Reserve(Nearest.Num());
+			for (const int32 PointIndex : Nearest)
+			{
+				if (bCenterToCenter) { RegisterTarget(PointIndex, FVector::DistSquared(SourceCenter, (*LocalTypedContext->TargetPositions)[PointIndex])); }
+				else { SampleTarget(PointIndex, *(LocalTypedContext->TargetPoints->GetData() + PointIndex)); }
+			}
+		}
+		else if (RangeMax > 0)
 		{
 			const FBox Box = FBoxCenterAndExtent(SourceCenter, FVector(FMath::Sqrt(RangeMax))).GetBox();
 			auto ProcessNeighbor = [&](const FPCGPointRef& InPointRef)
 			{
 				const ptrdiff_t PointIndex = InPointRef.Point - LocalTypedContext->TargetPoints->GetData();
-				SampleTarget(PointIndex, *(LocalTypedContext->TargetPoints->GetData() + PointIndex));
+				if (bCenterToCenter) { RegisterTarget(PointIndex, FVector::DistSquared(SourceCenter, (*LocalTypedContext->TargetPositions)[PointIndex])); }
+				else { SampleTarget(PointIndex, *(LocalTypedContext->TargetPoints->GetData() + PointIndex)); }
 			};
 
 			LocalTypedContext->TargetOctree->FindElementsWithBoundsTest(Box, ProcessNeighbor);
@@ -241,7 +272,16 @@ namespace PCGExSampleNearestPoints
 		else
 		{
 			TargetsInfos.Reserve(LocalTypedContext->NumTargets);
-			for (int i = 0; i < LocalTypedContext->NumTargets; ++i) { SampleTarget(i, *(LocalTypedContext->TargetPoints->GetData() + i)); }
+			if (bCenterToCenter)
+			{
+				// Center-to-center distance only needs positions, read them from the contiguous column
+				const FVector* Positions = LocalTypedContext->TargetPositions->GetData();
+				for (int i = 0; i < LocalTypedContext->NumTargets; ++i) { RegisterTarget(i, FVector::DistSquared(SourceCenter, Positions[i])); }
+			}
+			else
+			{
+				for (int i = 0; i < LocalTypedContext->NumTargets; ++i) { SampleTarget(i, *(LocalTypedContext->TargetPoints->GetData() + i)); }
+			}
 		}
 
 		// Compound never got updated, meaning we couldn't find target in range
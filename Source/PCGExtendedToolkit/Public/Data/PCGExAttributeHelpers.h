@@ -600,6 +600,45 @@ namespace PCGEx
 		FPCGAttributePropertyInputSelector FetchSelector;
 		IPCGAttributeAccessor* FetchAccessor = nullptr;
 
+		bool bPassthroughSameType = false;  // Convert(const T&) is a plain copy
+		bool bPassthroughArithmetic = false; // Convert from an arithmetic type is a plain static_cast
+
+		/**
+		 * Non-virtual conversion of a contiguous range of raw values.
+		 * Source/target types are resolved at compile time, the passthrough flags once per range.
+		 * @return false if the pair isn't covered, in which case the caller must fall back to per-value Convert.
+		 */
+		template <typename RawT>
+		bool ConvertRange(const RawT* RESTRICT In, T* RESTRICT Out, const int32 Count) const
+		{
+			if constexpr (std::is_same_v<RawT, T>)
+			{
+				if (!bPassthroughSameType) { return false; }
+				if constexpr (std::is_trivially_copyable_v<T>) { FMemory::Memcpy(Out, In, Count * sizeof(T)); }
+				else { for (int i = 0; i < Count; ++i) { Out[i] = In[i]; } }
+				return true;
+			}
+			else if constexpr (std::is_arithmetic_v<RawT> && std::is_arithmetic_v<T>)
+			{
+				if (!bPassthroughArithmetic) { return false; }
+				for (int i = 0; i < Count; ++i) { Out[i] = static_cast<T>(In[i]); }
+				return true;
+			}
+			else
+			{
+				return false;
+			}
+		}
+
+		void CaptureMinMax(const T* In, const int32 Count, T& OutMin, T& OutMax) const
+		{
+			for (int i = 0; i < Count; ++i)
+			{
+				OutMin = PCGExMath::Min(In[i], OutMin);
+				OutMax = PCGExMath::Max(In[i], OutMax);
+			}
+		}
+
 	public:
 		TAttributeGetter()
 		{
@@ -713,7 +752,11 @@ namespace PCGEx
 						TArrayView<RawT> RawView(RawValues);
 						Accessor->GetRange(RawView, StartIndex, *Keys, PCGEX_AAFLAG);
 
-						for (int i = 0; i < Count; ++i) { Dump[StartIndex + i] = Convert(RawValues[i]); }
+						if (!ConvertRange(RawValues.GetData(), Dump.GetData() + StartIndex, Count))
+						{
+							for (int i = 0; i < Count; ++i) { Dump[StartIndex + i] = Convert(RawValues[i]); }
+						}
+
 						RawValues.Empty();
 					});
 
@@ -734,6 +777,15 @@ namespace PCGEx
 				switch (FetchSelector.GetExtraProperty())
 				{
 				case EPCGExtraProperties::Index:
+					if constexpr (std::is_arithmetic_v<T>)
+					{
+						if (bPassthroughArithmetic)
+						{
+							for (int i = StartIndex; i < LastIndex; ++i) { Dump[i] = static_cast<T>(i); }
+							bValid = true;
+							break;
+						}
+					}
 					for (int i = StartIndex; i < LastIndex; ++i) { Dump[i] = Convert(i); }
 					bValid = true;
 					break;
@@ -794,7 +846,11 @@ namespace PCGEx
 						TArrayView<RawT> View(RawValues);
 						Accessor->GetRange(View, 0, *Keys, PCGEX_AAFLAG);
 
-						if (bCaptureMinMax)
+						if (ConvertRange(RawValues.GetData(), Dump.GetData(), NumPoints))
+						{
+							if (bCaptureMinMax) { CaptureMinMax(Dump.GetData(), NumPoints, OutMin, OutMax); }
+						}
+						else if (bCaptureMinMax)
 						{
 							for (int i = 0; i < NumPoints; ++i)
 							{
@@ -1061,6 +1117,14 @@ namespace PCGEx
 
 	class /*PCGEXTENDEDTOOLKIT_API*/ FLocalSingleFieldGetter : public TAttributeGetter<double>
 	{
+	public:
+		FLocalSingleFieldGetter()
+		{
+			bPassthroughSameType = true;
+			bPassthroughArithmetic = true;
+		}
+
+	private:
 		virtual EPCGMetadataTypes GetType() override { return EPCGMetadataTypes::Double; }
 
 	protected:
@@ -1168,6 +1232,14 @@ namespace PCGEx
 
 	class /*PCGEXTENDEDTOOLKIT_API*/ FLocalIntegerGetter final : public TAttributeGetter<int32>
 	{
+	public:
+		FLocalIntegerGetter()
+		{
+			bPassthroughSameType = true;
+			bPassthroughArithmetic = true;
+		}
+
+	private:
 		virtual EPCGMetadataTypes GetType() override { return EPCGMetadataTypes::Integer32; }
 
 	protected:
@@ -1275,6 +1347,10 @@ namespace PCGEx
 
 	class /*PCGEXTENDEDTOOLKIT_API*/ FLocalBoolGetter final : public TAttributeGetter<bool>
 	{
+	public:
+		FLocalBoolGetter() { bPassthroughSameType = true; }
+
+	private:
 		virtual EPCGMetadataTypes GetType() override { return EPCGMetadataTypes::Boolean; }
 
 	protected:
@@ -1382,6 +1458,10 @@ namespace PCGEx
 
 	class /*PCGEXTENDEDTOOLKIT_API*/ FLocalVectorGetter final : public TAttributeGetter<FVector>
 	{
+	public:
+		FLocalVectorGetter() { bPassthroughSameType = true; }
+
+	private:
 		virtual EPCGMetadataTypes GetType() override { return EPCGMetadataTypes::Vector; }
 
 	protected:
@@ -1422,6 +1502,10 @@ namespace PCGEx
 
 	class /*PCGEXTENDEDTOOLKIT_API*/ FLocalToStringGetter final : public TAttributeGetter<FString>
 	{
+	public:
+		FLocalToStringGetter() { bPassthroughSameType = true; }
+
+	private:
 		virtual EPCGMetadataTypes GetType() override { return EPCGMetadataTypes::String; }
 
 	protected:
@@ -290,10 +290,35 @@ namespace PCGExData
 		}
 	};
 
+	/**
+	 * Column-oriented copy of the point properties hot loops read the most.
+	 * Built once from a point data and shared by every consumer of the owning facade.
+	 */
+	struct /*PCGEXTENDEDTOOLKIT_API*/ FPointColumns
+	{
+		TArray<FVector> Positions;
+		TArray<FQuat> Rotations;
+		TArray<FVector> Scales;
+		TArray<FVector> BoundsMin;
+		TArray<FVector> BoundsMax;
+		TArray<float> Density;
+		TArray<int32> Seed;
+
+		explicit FPointColumns(const UPCGPointData* InData);
+
+		FORCEINLINE int32 Num() const { return Positions.Num(); }
+	};
+
 	class /*PCGEXTENDEDTOOLKIT_API*/ FFacade
 	{
 		mutable FRWLock PoolLock;
 		mutable FRWLock CloudLock;
+		mutable FRWLock ColumnsLock;
+
+		FPointColumns* InColumns = nullptr;
+		FPointColumns* OutColumns = nullptr;
+		TArray<FVector>* InPositions = nullptr;
+		TArray<FVector>* OutPositions = nullptr;
 
 	public:
 		FPointIO* Source = nullptr;
@@ -568,6 +593,71 @@ namespace PCGExData
 			return Cloud;
 		}
 
+		/**
+		 * Lazily build & return the column view of the selected source.
+		 * Out columns are a snapshot; call InvalidateColumns after mutating output points.
+		 */
+		const FPointColumns* GetColumns(const ESource InSource = ESource::In)
+		{
+			FPointColumns*& Columns = InSource == ESource::In ? InColumns : OutColumns;
+
+			{
+				FReadScopeLock ReadScopeLock(ColumnsLock);
+				if (Columns) { return Columns; }
+			}
+
+			FWriteScopeLock WriteScopeLock(ColumnsLock);
+			if (Columns) { return Columns; }
+
+			const UPCGPointData* Data = Source->GetData(InSource);
+			if (!Data) { return nullptr; }
+
+			Columns = new FPointColumns(Data);
+			return Columns;
+		}
+
+		/** Positions only, for consumers that don't need every column. Reuses full columns when they're already built. */
+		const TArray<FVector>* GetPositions(const ESource InSource = ESource::In)
+		{
+			FPointColumns*& Columns = InSource == ESource::In ? InColumns : OutColumns;
+			TArray<FVector>*& Positions = InSource == ESource::In ? InPositions : OutPositions;
+
+			{
+				FReadScopeLock ReadScopeLock(ColumnsLock);
+				if (Columns) { return &Columns->Positions; }
+				if (Positions) { return Positions; }
+			}
+
+			FWriteScopeLock WriteScopeLock(ColumnsLock);
+			if (Columns) { return &Columns->Positions; }
+			if (Positions) { return Positions; }
+
+			const UPCGPointData* Data = Source->GetData(InSource);
+			if (!Data) { return nullptr; }
+
+			const TArray<FPCGPoint>& Points = Data->GetPoints();
+			Positions = new TArray<FVector>();
+			PCGEX_SET_NUM_UNINITIALIZED_PTR(Positions, Points.Num())
+			for (int i = 0; i < Points.Num(); ++i) { (*Positions)[i] = Points[i].Transform.GetLocation(); }
+
+			return Positions;
+		}
+
+		void InvalidateColumns(const ESource InSource = ESource::Out)
+		{
+			FWriteScopeLock WriteScopeLock(ColumnsLock);
+			if (InSource == ESource::In)
+			{
+				PCGEX_DELETE(InColumns)
+				PCGEX_DELETE(InPositions)
+			}
+			else
+			{
+				PCGEX_DELETE(OutColumns)
+				PCGEX_DELETE(OutPositions)
+			}
+		}
+
 		const UPCGPointData* GetData(const ESource InSource) const { return Source->GetData(InSource); }
 		const UPCGPointData* GetIn() const { return Source->GetIn(); }
 		UPCGPointData* GetOut() const { return Source->GetOut(); }
@@ -577,6 +667,10 @@ namespace PCGExData
 			Flush();
 			Source = nullptr;
 			PCGEX_DELETE(Cloud)
+			PCGEX_DELETE(InColumns)
+			PCGEX_DELETE(OutColumns)
+			PCGEX_DELETE(InPositions)
+			PCGEX_DELETE(OutPositions)
 		}
 
 		void Flush()
@@ -587,6 +681,7 @@ namespace PCGExData
 
 		void Write(PCGExMT::FTaskManager* AsyncManager, const bool bFlush)
 		{
+			InvalidateColumns(ESource::Out);
 			for (FCacheBase* Cache : Caches) { Cache->Write(AsyncManager); }
 			if (bFlush) { Flush(); }
 		}
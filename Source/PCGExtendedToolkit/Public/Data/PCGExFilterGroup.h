@@ -29,6 +29,8 @@ class /*PCGEXTENDEDTOOLKIT_API*/ UPCGExFilterGroupFactoryBase : public UPCGExClu
 
 public:
 	bool bInvert = false;
+	bool bReorderBySelectivity = false;
+	int32 SelectivitySampleSize = 256;
 	TArray<UPCGExFilterFactoryBase*> FilterFactories;
 
 	virtual PCGExFactories::EType GetFactoryType() const override { return PCGExFactories::EType::FilterGroup; }
@@ -87,10 +89,16 @@ namespace PCGExFilterGroup
 
 		virtual void PostInit() override;
 
+		virtual EPCGExFilterGroupMode GetMode() const = 0;
+		const TArray<PCGExPointFilter::TFilter*>& GetManagedFilters() const { return ManagedFilters; }
+
 		virtual bool Test(const int32 Index) const override = 0;
 		virtual bool Test(const PCGExCluster::FNode& Node) const override = 0;
 		virtual bool Test(const PCGExGraph::FIndexedEdge& Edge) const override = 0;
 
+		/** Constant when empty, when every managed filter is constant, or when one constant filter decides the group outright. */
+		virtual bool IsConstant(bool& OutResult) const override;
+
 		virtual ~TFilterGroup() override
 		{
 			Results.Empty();
@@ -104,6 +112,9 @@ namespace PCGExFilterGroup
 		bool InitManagedFilter(const FPCGContext* InContext, PCGExPointFilter::TFilter* Filter);
 		virtual bool PostInitManaged(const FPCGContext* InContext);
 		virtual void PostInitManagedFilter(const FPCGContext* InContext, PCGExPointFilter::TFilter* InFilter);
+
+		/** Sample filters cost & pass rate and sort them for earliest short-circuit. */
+		void ReorderBySelectivity(const FPCGContext* InContext);
 	};
 
 	class /*PCGEXTENDEDTOOLKIT_API*/ TFilterGroupAND : public TFilterGroup
@@ -114,6 +125,8 @@ namespace PCGExFilterGroup
 		{
 		}
 
+		virtual EPCGExFilterGroupMode GetMode() const override { return EPCGExFilterGroupMode::AND; }
+
 		FORCEINLINE virtual bool Test(const int32 Index) const override
 		{
 			for (const PCGExPointFilter::TFilter* Filter : ManagedFilters) { if (!Filter->Test(Index)) { return bInvert; } }
@@ -131,6 +144,12 @@ namespace PCGExFilterGroup
 			for (const PCGExPointFilter::TFilter* Filter : ManagedFilters) { if (!Filter->Test(Edge)) { return bInvert; } }
 			return !bInvert;
 		}
+
+		virtual void TestScope(const int32 StartIndex, const int32 Count, uint64* OutBits) const override
+		{
+			PCGExPointFilter::TestScopeAND(ManagedFilters, StartIndex, Count, OutBits);
+			if (bInvert) { PCGExPointFilter::InvertBits(OutBits, Count); }
+		}
 	};
 
 	class /*PCGEXTENDEDTOOLKIT_API*/ TFilterGroupOR : public TFilterGroup
@@ -141,6 +160,8 @@ namespace PCGExFilterGroup
 		{
 		}
 
+		virtual EPCGExFilterGroupMode GetMode() const override { return EPCGExFilterGroupMode::OR; }
+
 		FORCEINLINE virtual bool Test(const int32 Index) const override
 		{
 			for (const PCGExPointFilter::TFilter* Filter : ManagedFilters) { if (Filter->Test(Index)) { return !bInvert; } }
@@ -158,5 +179,11 @@ namespace PCGExFilterGroup
 			for (const PCGExPointFilter::TFilter* Filter : ManagedFilters) { if (Filter->Test(Edge)) { return !bInvert; } }
 			return bInvert;
 		}
+
+		virtual void TestScope(const int32 StartIndex, const int32 Count, uint64* OutBits) const override
+		{
+			PCGExPointFilter::TestScopeOR(ManagedFilters, StartIndex, Count, OutBits);
+			if (bInvert) { PCGExPointFilter::InvertBits(OutBits, Count); }
+		}
 	};
 }
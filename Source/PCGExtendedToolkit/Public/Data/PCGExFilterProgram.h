@@ -0,0 +1,85 @@
+﻿// Copyright Timothé Lapetite 2024
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "PCGExPointFilter.h"
+
+namespace PCGExCluster
+{
+	struct FNode;
+}
+
+namespace PCGExPointFilter
+{
+	enum class EFilterOp : uint8
+	{
+		Test = 0,
+		Const,
+		Not,
+		And,
+		Or,
+	};
+
+	struct /*PCGEXTENDEDTOOLKIT_API*/ FFilterInstruction
+	{
+		EFilterOp Op = EFilterOp::Test;
+		bool bConstValue = false;
+		const TFilter* Filter = nullptr;
+		int32 FirstOperand = 0;
+		int32 NumOperands = 0;
+		int32 NumUses = 0;
+	};
+
+	/**
+	 * Flat evaluation program compiled from a filter tree.
+	 * Each instruction writes its scope bitset into its own register, and operands always come before the instruction using them.
+	 * Groups become And/Or/Not instructions over their children, constants are folded,
+	 * and filters sharing the same factory are only evaluated once.
+	 * Evaluation runs from the root and narrows a live mask across And/Or operands, so operand order
+	 * (e.g. from group selectivity reordering) decides how much work later operands skip.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FFilterProgram
+	{
+	public:
+		FFilterProgram()
+		{
+		}
+
+		~FFilterProgram()
+		{
+		}
+
+		/** Compile the implicit AND of InFilters. Filters must be initialized. */
+		void Compile(const TArray<TFilter*>& InFilters);
+
+		int32 Num() const { return Instructions.Num(); }
+		bool IsConstant(bool& OutValue) const;
+
+		/**
+		 * Evaluate [StartIndex, StartIndex + Count[ into OutBits.
+		 * When InNodes is provided, Test instructions use the per-node test instead of the per-index one,
+		 * and only nodes still undecided by earlier operands are tested. Per-index tests are batched and only skip fully decided scopes.
+		 */
+		void Evaluate(const int32 StartIndex, const int32 Count, uint64* OutBits, const PCGExCluster::FNode* InNodes = nullptr) const;
+
+	protected:
+		TArray<FFilterInstruction> Instructions;
+		TArray<int32> Operands;
+		int32 Root = -1;
+
+		TMap<const UPCGExFilterFactoryBase*, int32> CompiledFactories;
+		int32 ConstRegisters[2] = {-1, -1};
+
+		struct FScope;
+		void EvaluateRegister(const int32 InRegister, const uint64* InLive, FScope& InScope) const;
+
+		int32 CompileFilter(const TFilter* InFilter);
+		int32 CompileCombine(const EFilterOp InOp, const TArray<int32>& InRegisters);
+		int32 EmitConst(const bool bValue);
+		int32 EmitNot(const int32 InRegister);
+		bool GetConst(const int32 InRegister, bool& OutValue) const;
+	};
+}
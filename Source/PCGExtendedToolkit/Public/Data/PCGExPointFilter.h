@@ -6,6 +6,7 @@
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
 #include "PCGExData.h"
+#include "PCGExCompare.h"
 #include "PCGExFactoryProvider.h"
 
 #include "PCGExPointFilter.generated.h"
@@ -23,6 +24,7 @@ namespace PCGExCluster
 namespace PCGExPointFilter
 {
 	class TFilter;
+	class FFilterProgram;
 }
 
 namespace PCGExFilters
@@ -71,6 +73,94 @@ namespace PCGExPointFilter
 	const FName OutputInsideFiltersLabel = FName("Inside");
 	const FName OutputOutsideFiltersLabel = FName("Outside");
 
+#pragma region Scope bitsets
+
+	// Scope results are packed one bit per point, bit 0 being the first point of the scope.
+	// Bits past the scope count are always left cleared.
+
+	FORCEINLINE int32 GetNumWords(const int32 Count) { return (Count + 63) >> 6; }
+
+	FORCEINLINE uint64 GetTailMask(const int32 Count)
+	{
+		const int32 Rem = Count & 63;
+		return Rem ? (1ull << Rem) - 1 : ~0ull;
+	}
+
+	FORCEINLINE bool GetBit(const uint64* Bits, const int32 Index) { return (Bits[Index >> 6] >> (Index & 63)) & 1; }
+
+	FORCEINLINE void InvertBits(uint64* Bits, const int32 Count)
+	{
+		const int32 NumWords = GetNumWords(Count);
+		if (!NumWords) { return; }
+		for (int i = 0; i < NumWords; ++i) { Bits[i] = ~Bits[i]; }
+		Bits[NumWords - 1] &= GetTailMask(Count);
+	}
+
+	FORCEINLINE bool AnyBits(const uint64* Bits, const int32 NumWords)
+	{
+		uint64 Acc = 0;
+		for (int i = 0; i < NumWords; ++i) { Acc |= Bits[i]; }
+		return Acc != 0;
+	}
+
+	FORCEINLINE bool AllBits(const uint64* Bits, const int32 Count)
+	{
+		const int32 NumWords = GetNumWords(Count);
+		if (!NumWords) { return true; }
+		uint64 Acc = ~0ull;
+		for (int i = 0; i < NumWords - 1; ++i) { Acc &= Bits[i]; }
+		return Acc == ~0ull && Bits[NumWords - 1] == GetTailMask(Count);
+	}
+
+	/** Pack Predicate(i) for i in [0, Count[ into OutBits. Full words use a fixed trip count so the inner loop can vectorize. */
+	template <typename PredicateFunc>
+	FORCEINLINE void PackBits(const int32 Count, uint64* OutBits, PredicateFunc&& Predicate)
+	{
+		const int32 NumFullWords = Count >> 6;
+		for (int w = 0; w < NumFullWords; ++w)
+		{
+			const int32 Offset = w << 6;
+			uint64 Word = 0;
+			for (int i = 0; i < 64; ++i) { Word |= static_cast<uint64>(Predicate(Offset + i)) << i; }
+			OutBits[w] = Word;
+		}
+
+		const int32 Rem = Count & 63;
+		if (!Rem) { return; }
+
+		const int32 Offset = NumFullWords << 6;
+		uint64 Word = 0;
+		for (int i = 0; i < Rem; ++i) { Word |= static_cast<uint64>(Predicate(Offset + i)) << i; }
+		OutBits[NumFullWords] = Word;
+	}
+
+	/** Pack GetA(i) <Method> GetB(i) into OutBits, with one kernel instantiated per comparison. */
+	template <typename GetAFunc, typename GetBFunc>
+	void PackCompare(const EPCGExComparison Method, const int32 Count, uint64* OutBits, GetAFunc&& GetA, GetBFunc&& GetB, const double Tolerance)
+	{
+#define PCGEX_PACK_COMPARE(_METHOD) case EPCGExComparison::_METHOD: \
+		PackBits(Count, OutBits, [&](const int32 i) { return PCGExCompare::CompareStatic<EPCGExComparison::_METHOD>(GetA(i), GetB(i), Tolerance); }); break;
+
+		switch (Method)
+		{
+		PCGEX_PACK_COMPARE(StrictlyEqual)
+		PCGEX_PACK_COMPARE(StrictlyNotEqual)
+		PCGEX_PACK_COMPARE(EqualOrGreater)
+		PCGEX_PACK_COMPARE(EqualOrSmaller)
+		PCGEX_PACK_COMPARE(StrictlyGreater)
+		PCGEX_PACK_COMPARE(StrictlySmaller)
+		PCGEX_PACK_COMPARE(NearlyEqual)
+		PCGEX_PACK_COMPARE(NearlyNotEqual)
+		default:
+			for (int w = 0; w < GetNumWords(Count); ++w) { OutBits[w] = 0; }
+			break;
+		}
+
+#undef PCGEX_PACK_COMPARE
+	}
+
+#pragma endregion
+
 	class /*PCGEXTENDEDTOOLKIT_API*/ TFilter
 	{
 	public:
@@ -98,6 +188,15 @@ namespace PCGExPointFilter
 		virtual bool Test(const PCGExCluster::FNode& Node) const;
 		virtual bool Test(const PCGExGraph::FIndexedEdge& Edge) const;
 
+		/**
+		 * Batched Test(Index) over [StartIndex, StartIndex + Count[, one bit per point.
+		 * OutBits must hold at least GetNumWords(Count) words.
+		 */
+		virtual void TestScope(const int32 StartIndex, const int32 Count, uint64* OutBits) const;
+
+		/** Whether this filter yields the same result for every point, which lets compiled programs fold it. */
+		virtual bool IsConstant(bool& OutResult) const { return false; }
+
 		virtual ~TFilter()
 		{
 			Results.Empty();
@@ -123,13 +222,14 @@ namespace PCGExPointFilter
 		virtual bool Test(const PCGExCluster::FNode& Node);
 		virtual bool Test(const PCGExGraph::FIndexedEdge& Edge);
 
-		virtual ~TManager()
-		{
-			PCGEX_DELETE_TARRAY(ManagedFilters)
-		}
+		virtual void TestScope(const int32 StartIndex, const int32 Count, uint64* OutBits);
+		virtual void TestScope(const PCGExCluster::FNode* InNodes, const int32 StartIndex, const int32 Count, uint64* OutBits);
+
+		virtual ~TManager();
 
 	protected:
 		TArray<TFilter*> ManagedFilters;
+		FFilterProgram* Program = nullptr;
 
 		virtual bool InitFilter(const FPCGContext* InContext, TFilter* Filter);
 		virtual bool PostInit(const FPCGContext* InContext);
@@ -137,4 +237,10 @@ namespace PCGExPointFilter
 
 		virtual void InitCache();
 	};
+
+	/** Word-wide AND of each filter scope results; stops evaluating filters once the scope is all-false. */
+	void TestScopeAND(const TArray<TFilter*>& InFilters, const int32 StartIndex, const int32 Count, uint64* OutBits);
+
+	/** Word-wide OR of each filter scope results; stops evaluating filters once the scope is all-true. */
+	void TestScopeOR(const TArray<TFilter*>& InFilters, const int32 StartIndex, const int32 Count, uint64* OutBits);
 }
@@ -20,7 +20,7 @@ namespace PCGExData
 	{
 		NoOutput UMETA(DisplayName = "No Output"),
 		NewOutput UMETA(DisplayName = "Create Empty Output Object"),
-		DuplicateInput UMETA(DisplayName = "Duplicate Input Object"),
+		DuplicateInput UMETA(DisplayName = "Duplicate Input Object"), // Metadata is parented to the input's; only the point array is copied, since UPCGPointData can't share it
 		Forward UMETA(DisplayName = "Forward Input Object")
 	};
 
@@ -179,10 +179,12 @@ namespace PCGExData
 		FPCGAttributeAccessorKeysPoints* CreateInKeys();
 		FORCEINLINE FPCGAttributeAccessorKeysPoints* GetInKeys() const { return InKeys; }
 		void PrintInKeysMap(TMap<PCGMetadataEntryKey, int32>& InMap);
+		void PrintInKeysMap(PCGEx::FIndexLookup& InLookup);
 
 		FPCGAttributeAccessorKeysPoints* CreateOutKeys();
 		FORCEINLINE FPCGAttributeAccessorKeysPoints* GetOutKeys() const { return OutKeys; }
 		void PrintOutKeysMap(TMap<PCGMetadataEntryKey, int32>& InMap, bool bInitializeOnSet);
+		void PrintOutKeysMap(PCGEx::FIndexLookup& InLookup, bool bInitializeOnSet);
 
 		FPCGAttributeAccessorKeysPoints* CreateKeys(ESource InSource);
 		FORCEINLINE FPCGAttributeAccessorKeysPoints* GetKeys(const ESource InSource) const { return InSource == ESource::In ? GetInKeys() : GetOutKeys(); }
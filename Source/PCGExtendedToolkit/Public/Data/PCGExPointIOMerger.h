@@ -33,6 +33,8 @@ public:
 
 protected:
 	int32 NumCompositePoints = 0;
+
+	void CopyPoints(const int32 StartIndex, const int32 Count);
 };
 
 namespace PCGExPointIOMerger
@@ -0,0 +1,81 @@
+﻿// Copyright Timothé Lapetite 2024
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Geometry/PCGExGeoSpatialIndex.h"
+
+class UPCGPointData;
+
+namespace PCGExData
+{
+	enum class ESpatialIndexKind : uint8
+	{
+		PositionKDTree = 0,
+		PositionGrid   = 1,
+	};
+
+	/**
+	 * Process-wide cache of spatial indices built over point data, keyed by data UID & index kind.
+	 * Point data is immutable once output, so an index built over it stays valid for as long as the data is alive.
+	 * Every Acquire must be paired with a Release; in-use indices are never evicted.
+	 * On release, indices whose data was garbage collected are deleted, since UIDs are never reused,
+	 * then the least recently used ones until the cache fits its memory budget.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FSpatialIndexCache
+	{
+	public:
+		static FSpatialIndexCache& Get();
+
+		~FSpatialIndexCache();
+
+		/** KD-tree over point positions. */
+		const PCGExGeo::FKDTree* AcquireKDTree(const UPCGPointData* InData);
+
+		/** Hash grid over point positions, with the given cell size. */
+		const PCGExGeo::FPointHashGrid* AcquireGrid(const UPCGPointData* InData, const double CellSize);
+
+		void Release(const void* InIndex);
+
+		/** Deletes every index that isn't in use. */
+		void Flush();
+
+	protected:
+		struct FKey
+		{
+			uint64 DataUID = 0;
+			uint64 Param = 0;
+			ESpatialIndexKind Kind = ESpatialIndexKind::PositionKDTree;
+
+			bool operator==(const FKey& Other) const { return DataUID == Other.DataUID && Param == Other.Param && Kind == Other.Kind; }
+			friend uint32 GetTypeHash(const FKey& Key) { return HashCombine(HashCombine(GetTypeHash(Key.DataUID), GetTypeHash(Key.Param)), static_cast<uint32>(Key.Kind)); }
+		};
+
+		struct FEntry
+		{
+			FKey Key;
+			TWeakObjectPtr<const UPCGPointData> Data;
+			const void* Index = nullptr;
+			SIZE_T Size = 0;
+			int32 RefCount = 0;
+			uint64 LastUse = 0;
+		};
+
+		mutable FRWLock CacheLock;
+		TMap<FKey, FEntry*> Entries;
+		TMap<const void*, FEntry*> EntriesByIndex;
+		SIZE_T TotalSize = 0;
+		uint64 UseCounter = 0;
+
+		/** Returns a cached index and pins it, or nullptr. */
+		const void* TryAcquire(const FKey& Key);
+
+		/** Registers a freshly built index and pins it. If another thread registered the same key first, the given index is deleted and the existing one returned. */
+		const void* Register(const FKey& Key, const UPCGPointData* InData, const void* InIndex, const SIZE_T InSize);
+
+		void EvictUnused(const SIZE_T Budget);
+		void RemoveEntry(FEntry* Entry);
+		static void DeleteIndex(const FEntry* Entry);
+	};
+}
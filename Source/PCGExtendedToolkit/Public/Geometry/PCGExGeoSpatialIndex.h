@@ -0,0 +1,768 @@
+﻿// Copyright Timothé Lapetite 2024
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGEx.h"
+#include "PCGPoint.h"
+
+#include <algorithm>
+
+namespace PCGExGeo
+{
+	namespace SpatialIndex
+	{
+		using FDistItem = TPair<double, int32>;
+
+		FORCEINLINE static int32 GetLargestAxis(const FVector& Extents)
+		{
+			return Extents.X >= Extents.Y ? (Extents.X >= Extents.Z ? 0 : 2) : (Extents.Y >= Extents.Z ? 1 : 2);
+		}
+
+		/**
+		 * Pushes a candidate into a bounded max-heap of size K.
+		 * Returns the current K-th distance, or Max if the heap isn't full yet.
+		 */
+		FORCEINLINE static double PushKNearest(TArray<FDistItem>& Heap, const int32 K, const double DistSquared, const int32 Item)
+		{
+			auto MaxHeap = [](const FDistItem& A, const FDistItem& B) { return A.Key > B.Key; };
+
+			if (Heap.Num() < K) { Heap.HeapPush(FDistItem(DistSquared, Item), MaxHeap); }
+			else if (DistSquared < Heap.HeapTop().Key)
+			{
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION <= 3
+				Heap.HeapPopDiscard(MaxHeap, false);
+#else
+				Heap.HeapPopDiscard(MaxHeap, EAllowShrinking::No);
+#endif
+				Heap.HeapPush(FDistItem(DistSquared, Item), MaxHeap);
+			}
+
+			return Heap.Num() < K ? TNumericLimits<double>::Max() : Heap.HeapTop().Key;
+		}
+
+		FORCEINLINE static void FlushKNearest(TArray<FDistItem>& Heap, TArray<int32>& OutItems)
+		{
+			Heap.Sort([](const FDistItem& A, const FDistItem& B) { return A.Key < B.Key; });
+			OutItems.Reset(Heap.Num());
+			for (const FDistItem& Item : Heap) { OutItems.Add(Item.Value); }
+		}
+	}
+
+	/**
+	 * Immutable, array-based KD-tree over a set of positions.
+	 * The tree is implicit : the item splitting [Lo, Hi[ sits at its midpoint, with each half on either side,
+	 * so the whole structure is three flat arrays and queries don't chase any pointer.
+	 * Built on the calling thread; callers parallelize across indices (e.g. one per cluster).
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FKDTree
+	{
+	public:
+		explicit FKDTree(const TArray<FVector>& InPositions)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(FKDTree::Build);
+
+			const int32 NumItems = InPositions.Num();
+
+			Items.SetNumUninitialized(NumItems);
+			Axes.SetNumUninitialized(NumItems);
+			for (int i = 0; i < NumItems; ++i) { Items[i] = i; }
+
+			Build(InPositions, 0, NumItems);
+
+			Positions.SetNumUninitialized(NumItems);
+			for (int i = 0; i < NumItems; ++i) { Positions[i] = InPositions[Items[i]]; }
+		}
+
+		FORCEINLINE int32 Num() const { return Items.Num(); }
+		SIZE_T GetAllocatedSize() const { return Items.GetAllocatedSize() + Positions.GetAllocatedSize() + Axes.GetAllocatedSize(); }
+
+		/**
+		 * Exact nearest item for which Filter(Item) returns true.
+		 * @return the item index, or -1 if none passed the filter 
+		 */
+		template <typename FilterFunc>
+		int32 FindNearest(const FVector& Position, FilterFunc&& Filter, double& OutDistSquared) const
+		{
+			int32 Best = -1;
+			OutDistSquared = TNumericLimits<double>::Max();
+			FindNearestInternal(0, Items.Num(), Position, Filter, Best, OutDistSquared);
+			return Best;
+		}
+
+		int32 FindNearest(const FVector& Position) const
+		{
+			double DistSquared = 0;
+			return FindNearest(Position, [](const int32) { return true; }, DistSquared);
+		}
+
+		/**
+		 * Exact K nearest items for which Filter(Item) returns true, sorted from nearest to farthest.
+		 * Only items strictly closer than MaxDistSquared are considered; the bound also prunes the search.
+		 */
+		template <typename FilterFunc>
+		void FindKNearest(const FVector& Position, const int32 K, TArray<int32>& OutItems, FilterFunc&& Filter, const double MaxDistSquared = TNumericLimits<double>::Max()) const
+		{
+			OutItems.Reset();
+			if (K <= 0) { return; }
+
+			TArray<SpatialIndex::FDistItem> Heap;
+			Heap.Reserve(K);
+
+			double Bound = MaxDistSquared;
+			FindKNearestInternal(0, Items.Num(), Position, K, Filter, Heap, Bound);
+			SpatialIndex::FlushKNearest(Heap, OutItems);
+		}
+
+		void FindKNearest(const FVector& Position, const int32 K, TArray<int32>& OutItems) const
+		{
+			FindKNearest(Position, K, OutItems, [](const int32) { return true; });
+		}
+
+		/**
+		 * Calls Callback(Item, DistSquared) for every item within Radius of Position, in no particular order.
+		 */
+		template <typename CallbackFunc>
+		void FindInRadius(const FVector& Position, const double Radius, CallbackFunc&& Callback) const
+		{
+			FindInRadiusInternal(0, Items.Num(), Position, Radius * Radius, Callback);
+		}
+
+		/**
+		 * Calls Callback(Item) for every item inside Box, in no particular order.
+		 */
+		template <typename CallbackFunc>
+		void FindInBox(const FBox& Box, CallbackFunc&& Callback) const
+		{
+			FindInBoxInternal(0, Items.Num(), Box, Callback);
+		}
+
+	protected:
+		TArray<int32> Items;     // Source item index, in tree order
+		TArray<FVector> Positions; // Item position, in tree order
+		TArray<uint8> Axes;      // Split axis, in tree order
+
+		void Build(const TArray<FVector>& InPositions, const int32 Lo, const int32 Hi)
+		{
+			const int32 Count = Hi - Lo;
+			if (Count <= 0) { return; }
+
+			const int32 Mid = (Lo + Hi) >> 1;
+			if (Count == 1)
+			{
+				Axes[Mid] = 0;
+				return;
+			}
+
+			FBox RangeBounds(ForceInit);
+			for (int i = Lo; i < Hi; ++i) { RangeBounds += InPositions[Items[i]]; }
+
+			const int32 Axis = SpatialIndex::GetLargestAxis(RangeBounds.GetExtent());
+			int32* Data = Items.GetData();
+			std::nth_element(
+				Data + Lo, Data + Mid, Data + Hi,
+				[&](const int32 A, const int32 B) { return InPositions[A][Axis] < InPositions[B][Axis]; });
+
+			Axes[Mid] = static_cast<uint8>(Axis);
+
+			Build(InPositions, Lo, Mid);
+			Build(InPositions, Mid + 1, Hi);
+		}
+
+		template <typename FilterFunc>
+		void FindNearestInternal(const int32 Lo, const int32 Hi, const FVector& Position, FilterFunc& Filter, int32& Best, double& BestDistSquared) const
+		{
+			if (Lo >= Hi) { return; }
+
+			const int32 Mid = (Lo + Hi) >> 1;
+			const FVector& Pivot = Positions[Mid];
+
+			const double DistSquared = FVector::DistSquared(Position, Pivot);
+			if (DistSquared < BestDistSquared && Filter(Items[Mid]))
+			{
+				BestDistSquared = DistSquared;
+				Best = Items[Mid];
+			}
+
+			const int32 Axis = Axes[Mid];
+			const double Delta = Position[Axis] - Pivot[Axis];
+
+			if (Delta < 0)
+			{
+				FindNearestInternal(Lo, Mid, Position, Filter, Best, BestDistSquared);
+				if (Delta * Delta < BestDistSquared) { FindNearestInternal(Mid + 1, Hi, Position, Filter, Best, BestDistSquared); }
+			}
+			else
+			{
+				FindNearestInternal(Mid + 1, Hi, Position, Filter, Best, BestDistSquared);
+				if (Delta * Delta < BestDistSquared) { FindNearestInternal(Lo, Mid, Position, Filter, Best, BestDistSquared); }
+			}
+		}
+
+		template <typename FilterFunc>
+		void FindKNearestInternal(const int32 Lo, const int32 Hi, const FVector& Position, const int32 K, FilterFunc& Filter, TArray<SpatialIndex::FDistItem>& Heap, double& Bound) const
+		{
+			if (Lo >= Hi) { return; }
+
+			const int32 Mid = (Lo + Hi) >> 1;
+			const FVector& Pivot = Positions[Mid];
+
+			const double DistSquared = FVector::DistSquared(Position, Pivot);
+			if (DistSquared < Bound && Filter(Items[Mid])) { Bound = SpatialIndex::PushKNearest(Heap, K, DistSquared, Items[Mid]); }
+
+			const int32 Axis = Axes[Mid];
+			const double Delta = Position[Axis] - Pivot[Axis];
+
+			if (Delta < 0)
+			{
+				FindKNearestInternal(Lo, Mid, Position, K, Filter, Heap, Bound);
+				if (Delta * Delta < Bound) { FindKNearestInternal(Mid + 1, Hi, Position, K, Filter, Heap, Bound); }
+			}
+			else
+			{
+				FindKNearestInternal(Mid + 1, Hi, Position, K, Filter, Heap, Bound);
+				if (Delta * Delta < Bound) { FindKNearestInternal(Lo, Mid, Position, K, Filter, Heap, Bound); }
+			}
+		}
+
+		template <typename CallbackFunc>
+		void FindInRadiusInternal(const int32 Lo, const int32 Hi, const FVector& Position, const double RadiusSquared, CallbackFunc& Callback) const
+		{
+			if (Lo >= Hi) { return; }
+
+			const int32 Mid = (Lo + Hi) >> 1;
+			const FVector& Pivot = Positions[Mid];
+
+			const double DistSquared = FVector::DistSquared(Position, Pivot);
+			if (DistSquared <= RadiusSquared) { Callback(Items[Mid], DistSquared); }
+
+			const int32 Axis = Axes[Mid];
+			const double Delta = Position[Axis] - Pivot[Axis];
+			const bool bCrosses = Delta * Delta <= RadiusSquared;
+
+			if (Delta < 0 || bCrosses) { FindInRadiusInternal(Lo, Mid, Position, RadiusSquared, Callback); }
+			if (Delta >= 0 || bCrosses) { FindInRadiusInternal(Mid + 1, Hi, Position, RadiusSquared, Callback); }
+		}
+
+		template <typename CallbackFunc>
+		void FindInBoxInternal(const int32 Lo, const int32 Hi, const FBox& Box, CallbackFunc& Callback) const
+		{
+			if (Lo >= Hi) { return; }
+
+			const int32 Mid = (Lo + Hi) >> 1;
+			const FVector& Pivot = Positions[Mid];
+
+			if (Box.IsInsideOrOn(Pivot)) { Callback(Items[Mid]); }
+
+			const int32 Axis = Axes[Mid];
+			if (Box.Min[Axis] <= Pivot[Axis]) { FindInBoxInternal(Lo, Mid, Box, Callback); }
+			if (Box.Max[Axis] >= Pivot[Axis]) { FindInBoxInternal(Mid + 1, Hi, Box, Callback); }
+		}
+	};
+
+	/**
+	 * Immutable, array-based bounding volume hierarchy over a set of boxes.
+	 * Nodes are stored depth-first : the left child always directly follows its parent,
+	 * and the right child is found at a relative offset.
+	 * Built on the calling thread; callers parallelize across indices (e.g. one per cluster).
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FBVH
+	{
+	public:
+		explicit FBVH(const TArray<FBox>& InBounds, const int32 InLeafSize = 4)
+			: LeafSize(FMath::Max(1, InLeafSize))
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(FBVH::Build);
+
+			const int32 NumItems = InBounds.Num();
+
+			Items.SetNumUninitialized(NumItems);
+			for (int i = 0; i < NumItems; ++i) { Items[i] = i; }
+
+			if (NumItems == 0) { return; }
+
+			TArray<FVector> Centers;
+			Centers.SetNumUninitialized(NumItems);
+			for (int i = 0; i < NumItems; ++i) { Centers[i] = InBounds[i].GetCenter(); }
+
+			Nodes.Reserve(2 * (NumItems / LeafSize + 1));
+			Build(InBounds, Centers, 0, NumItems);
+
+			ItemBounds.SetNumUninitialized(NumItems);
+			for (int i = 0; i < NumItems; ++i) { ItemBounds[i] = InBounds[Items[i]]; }
+		}
+
+		FORCEINLINE int32 Num() const { return Items.Num(); }
+		SIZE_T GetAllocatedSize() const { return Nodes.GetAllocatedSize() + Items.GetAllocatedSize() + ItemBounds.GetAllocatedSize(); }
+
+		/**
+		 * Calls Callback(Item) for every item whose bounds overlap Box.
+		 * Callback returns false to stop the search early.
+		 */
+		template <typename CallbackFunc>
+		void FindOverlapping(const FBox& Box, CallbackFunc&& Callback) const
+		{
+			if (Nodes.IsEmpty()) { return; }
+
+			TArray<int32, TInlineAllocator<64>> Stack;
+			Stack.Add(0);
+
+			while (!Stack.IsEmpty())
+			{
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION <= 3
+				const int32 NodeIndex = Stack.Pop(false);
+#else
+				const int32 NodeIndex = Stack.Pop(EAllowShrinking::No);
+#endif
+				const FNode& Node = Nodes[NodeIndex];
+
+				if (!Node.Bounds.Intersect(Box)) { continue; }
+
+				if (Node.IsLeaf())
+				{
+					for (int i = Node.Start; i < Node.Start + Node.Count; ++i)
+					{
+						if (!ItemBounds[i].Intersect(Box)) { continue; }
+						if (!Callback(Items[i])) { return; }
+					}
+					continue;
+				}
+
+				Stack.Add(NodeIndex + Node.RightOffset);
+				Stack.Add(NodeIndex + 1);
+			}
+		}
+
+		/**
+		 * Exact nearest item given a per-item squared distance, DistSquared(Item).
+		 * DistSquared must never be smaller than the squared distance to the item bounds.
+		 * @return the item index, or -1 if the hierarchy is empty
+		 */
+		template <typename DistFunc>
+		int32 FindNearest(const FVector& Position, DistFunc&& DistSquared, double& OutDistSquared) const
+		{
+			int32 Best = -1;
+			OutDistSquared = TNumericLimits<double>::Max();
+
+			ForEachCandidate(
+				Position, [&]() { return OutDistSquared; },
+				[&](const int32 Item)
+				{
+					const double Dist = DistSquared(Item);
+					if (Dist < OutDistSquared)
+					{
+						OutDistSquared = Dist;
+						Best = Item;
+					}
+				});
+
+			return Best;
+		}
+
+		/**
+		 * Exact K nearest items given a per-item squared distance, sorted from nearest to farthest.
+		 */
+		template <typename DistFunc>
+		void FindKNearest(const FVector& Position, const int32 K, TArray<int32>& OutItems, DistFunc&& DistSquared) const
+		{
+			OutItems.Reset();
+			if (K <= 0) { return; }
+
+			TArray<SpatialIndex::FDistItem> Heap;
+			Heap.Reserve(K);
+
+			double Bound = TNumericLimits<double>::Max();
+			ForEachCandidate(
+				Position, [&]() { return Bound; },
+				[&](const int32 Item)
+				{
+					const double Dist = DistSquared(Item);
+					if (Dist < Bound) { Bound = SpatialIndex::PushKNearest(Heap, K, Dist, Item); }
+				});
+
+			SpatialIndex::FlushKNearest(Heap, OutItems);
+		}
+
+		/**
+		 * Calls Callback(Item, DistSquared) for every item within Radius of Position, given a per-item squared distance.
+		 */
+		template <typename DistFunc, typename CallbackFunc>
+		void FindInRadius(const FVector& Position, const double Radius, DistFunc&& DistSquared, CallbackFunc&& Callback) const
+		{
+			const double RadiusSquared = Radius * Radius;
+			FindOverlapping(
+				FBox(Position - FVector(Radius), Position + FVector(Radius)),
+				[&](const int32 Item)
+				{
+					const double Dist = DistSquared(Item);
+					if (Dist <= RadiusSquared) { Callback(Item, Dist); }
+					return true;
+				});
+		}
+
+	protected:
+		struct FNode
+		{
+			FBox Bounds = FBox(ForceInit);
+			int32 Start = 0;
+			int32 Count = 0;       // > 0 for leaves
+			int32 RightOffset = 0; // Right child is at this node index + RightOffset
+
+			FORCEINLINE bool IsLeaf() const { return Count > 0; }
+		};
+
+		int32 LeafSize = 4;
+		TArray<FNode> Nodes;
+		TArray<int32> Items;     // Source item index, in leaf order
+		TArray<FBox> ItemBounds; // Item bounds, in leaf order
+
+		void Build(const TArray<FBox>& InBounds, const TArray<FVector>& InCenters, const int32 Lo, const int32 Hi)
+		{
+			const int32 Count = Hi - Lo;
+
+			const int32 NodeIndex = Nodes.Emplace();
+			FNode& Node = Nodes[NodeIndex];
+
+			FBox CenterBounds(ForceInit);
+			for (int i = Lo; i < Hi; ++i)
+			{
+				Node.Bounds += InBounds[Items[i]];
+				CenterBounds += InCenters[Items[i]];
+			}
+
+			if (Count <= LeafSize)
+			{
+				Node.Start = Lo;
+				Node.Count = Count;
+				return;
+			}
+
+			const int32 Mid = (Lo + Hi) >> 1;
+			const int32 Axis = SpatialIndex::GetLargestAxis(CenterBounds.GetExtent());
+			int32* Data = Items.GetData();
+			std::nth_element(
+				Data + Lo, Data + Mid, Data + Hi,
+				[&](const int32 A, const int32 B) { return InCenters[A][Axis] < InCenters[B][Axis]; });
+
+			// Children may reallocate Nodes, so the parent is only accessed by index from here on
+			Build(InBounds, InCenters, Lo, Mid);
+			Nodes[NodeIndex].RightOffset = Nodes.Num() - NodeIndex;
+			Build(InBounds, InCenters, Mid, Hi);
+		}
+
+		/**
+		 * Best-first traversal : visits leaf items ordered by their node distance to Position,
+		 * until the closest remaining node is farther than GetBound().
+		 */
+		template <typename BoundFunc, typename VisitFunc>
+		void ForEachCandidate(const FVector& Position, BoundFunc&& GetBound, VisitFunc&& Visit) const
+		{
+			if (Nodes.IsEmpty()) { return; }
+
+			auto MinHeap = [](const SpatialIndex::FDistItem& A, const SpatialIndex::FDistItem& B) { return A.Key < B.Key; };
+
+			TArray<SpatialIndex::FDistItem, TInlineAllocator<64>> Queue;
+			Queue.HeapPush(SpatialIndex::FDistItem(Nodes[0].Bounds.ComputeSquaredDistanceToPoint(Position), 0), MinHeap);
+
+			while (!Queue.IsEmpty())
+			{
+				SpatialIndex::FDistItem Current;
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION <= 3
+				Queue.HeapPop(Current, MinHeap, false);
+#else
+				Queue.HeapPop(Current, MinHeap, EAllowShrinking::No);
+#endif
+
+				if (Current.Key >= GetBound()) { break; }
+
+				const FNode& Node = Nodes[Current.Value];
+
+				if (Node.IsLeaf())
+				{
+					for (int i = Node.Start; i < Node.Start + Node.Count; ++i)
+					{
+						if (ItemBounds[i].ComputeSquaredDistanceToPoint(Position) >= GetBound()) { continue; }
+						Visit(Items[i]);
+					}
+					continue;
+				}
+
+				const int32 Left = Current.Value + 1;
+				const int32 Right = Current.Value + Node.RightOffset;
+				Queue.HeapPush(SpatialIndex::FDistItem(Nodes[Left].Bounds.ComputeSquaredDistanceToPoint(Position), Left), MinHeap);
+				Queue.HeapPush(SpatialIndex::FDistItem(Nodes[Right].Bounds.ComputeSquaredDistanceToPoint(Position), Right), MinHeap);
+			}
+		}
+	};
+
+	/**
+	 * Immutable uniform hash grid over a set of positions, for fixed-radius queries.
+	 * Cells are hashed into a power-of-two bucket table and items are laid out bucket by bucket with a counting sort,
+	 * so building is two linear passes and a query only scans the few buckets its box overlaps.
+	 * Queries are cheapest when the search radius is close to the cell size.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FPointHashGrid
+	{
+	public:
+		// Cell coordinates are packed on 21 bits per axis
+		static constexpr int32 MaxCellsPerAxis = 1 << 21;
+
+		/**
+		 * @param InCellSize Cell size, ideally the largest search radius
+		 * @param InPositions Positions, indexed by item
+		 * @param InItems Items to insert
+		 */
+		FPointHashGrid(const double InCellSize, const TArray<FVector>& InPositions, const TArray<int32>& InItems)
+			: InvCellSize(1 / InCellSize)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(FPointHashGrid::Build);
+
+			const int32 NumItems = InItems.Num();
+
+			FBox ItemBounds(ForceInit);
+			for (const int32 Item : InItems) { ItemBounds += InPositions[Item]; }
+
+			Origin = ItemBounds.IsValid ? ItemBounds.Min : FVector::ZeroVector;
+			MaxCell = ItemBounds.IsValid ? GetCell(ItemBounds.Max) : FIntVector::ZeroValue;
+
+			const uint32 NumBuckets = FMath::RoundUpToPowerOfTwo(FMath::Max(1, NumItems));
+			BucketMask = NumBuckets - 1;
+
+			TArray<uint64> Keys;
+			Keys.SetNumUninitialized(NumItems);
+
+			BucketStarts.SetNumZeroed(NumBuckets + 1);
+			for (int i = 0; i < NumItems; ++i)
+			{
+				Keys[i] = PackCell(GetCell(InPositions[InItems[i]]));
+				BucketStarts[GetBucket(Keys[i]) + 1]++;
+			}
+
+			for (uint32 i = 1; i <= NumBuckets; ++i) { BucketStarts[i] += BucketStarts[i - 1]; }
+
+			TArray<int32> Cursors = BucketStarts;
+
+			Items.SetNumUninitialized(NumItems);
+			CellKeys.SetNumUninitialized(NumItems);
+			Positions.SetNumUninitialized(NumItems);
+
+			for (int i = 0; i < NumItems; ++i)
+			{
+				const int32 Slot = Cursors[GetBucket(Keys[i])]++;
+				Items[Slot] = InItems[i];
+				CellKeys[Slot] = Keys[i];
+				Positions[Slot] = InPositions[InItems[i]];
+			}
+		}
+
+		/**
+		 * Whether a grid of the given cell size can index positions within Bounds
+		 */
+		static bool CanIndex(const FBox& Bounds, const double InCellSize)
+		{
+			if (InCellSize <= 0 || !Bounds.IsValid) { return false; }
+			const FVector NumCells = Bounds.GetSize() / InCellSize;
+			return NumCells.GetMax() < MaxCellsPerAxis - 1;
+		}
+
+		FORCEINLINE int32 Num() const { return Items.Num(); }
+		SIZE_T GetAllocatedSize() const { return BucketStarts.GetAllocatedSize() + Items.GetAllocatedSize() + CellKeys.GetAllocatedSize() + Positions.GetAllocatedSize(); }
+
+		/**
+		 * Calls Callback(Item) for every item inside Box, in no particular order.
+		 */
+		template <typename CallbackFunc>
+		void FindInBox(const FBox& Box, CallbackFunc&& Callback) const
+		{
+			ForEachSlotInBox(Box, [&](const int32 Slot) { Callback(Items[Slot]); });
+		}
+
+		/**
+		 * Calls Callback(Item, DistSquared) for every item within Radius of Position, in no particular order.
+		 */
+		template <typename CallbackFunc>
+		void FindInRadius(const FVector& Position, const double Radius, CallbackFunc&& Callback) const
+		{
+			const double RadiusSquared = Radius * Radius;
+			ForEachSlotInBox(
+				FBox(Position - FVector(Radius), Position + FVector(Radius)),
+				[&](const int32 Slot)
+				{
+					const double DistSquared = FVector::DistSquared(Position, Positions[Slot]);
+					if (DistSquared <= RadiusSquared) { Callback(Items[Slot], DistSquared); }
+				});
+		}
+
+	protected:
+		FVector Origin = FVector::ZeroVector;
+		double InvCellSize = 1;
+		FIntVector MaxCell = FIntVector::ZeroValue;
+		uint32 BucketMask = 0;
+
+		TArray<int32> BucketStarts; // Per bucket, first slot, with a trailing end sentinel
+		TArray<int32> Items;        // Source item index, in slot order
+		TArray<uint64> CellKeys;    // Packed cell coordinates, in slot order
+		TArray<FVector> Positions;  // Item position, in slot order
+
+		template <typename SlotFunc>
+		void ForEachSlotInBox(const FBox& Box, SlotFunc&& Func) const
+		{
+			if (Items.IsEmpty()) { return; }
+
+			const FIntVector Lo = GetCell(Box.Min);
+			const FIntVector Hi = GetCell(Box.Max);
+			const FIntVector CellMin(FMath::Max(0, Lo.X), FMath::Max(0, Lo.Y), FMath::Max(0, Lo.Z));
+			const FIntVector CellMax(FMath::Min(MaxCell.X, Hi.X), FMath::Min(MaxCell.Y, Hi.Y), FMath::Min(MaxCell.Z, Hi.Z));
+
+			for (int32 Z = CellMin.Z; Z <= CellMax.Z; ++Z)
+			{
+				for (int32 Y = CellMin.Y; Y <= CellMax.Y; ++Y)
+				{
+					for (int32 X = CellMin.X; X <= CellMax.X; ++X)
+					{
+						const uint64 Key = PackCell(FIntVector(X, Y, Z));
+						const uint32 Bucket = GetBucket(Key);
+
+						for (int32 Slot = BucketStarts[Bucket]; Slot < BucketStarts[Bucket + 1]; ++Slot)
+						{
+							// Buckets are shared by colliding cells
+							if (CellKeys[Slot] != Key || !Box.IsInsideOrOn(Positions[Slot])) { continue; }
+							Func(Slot);
+						}
+					}
+				}
+			}
+		}
+
+		FORCEINLINE FIntVector GetCell(const FVector& Position) const
+		{
+			const FVector Local = (Position - Origin) * InvCellSize;
+			return FIntVector(
+				FMath::Clamp(FMath::FloorToInt32(Local.X), -1, MaxCellsPerAxis - 1),
+				FMath::Clamp(FMath::FloorToInt32(Local.Y), -1, MaxCellsPerAxis - 1),
+				FMath::Clamp(FMath::FloorToInt32(Local.Z), -1, MaxCellsPerAxis - 1));
+		}
+
+		FORCEINLINE static uint64 PackCell(const FIntVector& Cell)
+		{
+			return static_cast<uint64>(Cell.X) | static_cast<uint64>(Cell.Y) << 21 | static_cast<uint64>(Cell.Z) << 42;
+		}
+
+		FORCEINLINE uint32 GetBucket(const uint64 Key) const
+		{
+			// Fibonacci hashing, keeps neighboring cells apart
+			return static_cast<uint32>((Key * 0x9E3779B97F4A7C15ull) >> 32) & BucketMask;
+		}
+	};
+
+#pragma region Space-filling curves
+
+	namespace SpatialOrder
+	{
+		constexpr int32 Bits = 21; // Per axis, so keys fit in 63 bits
+
+		FORCEINLINE static uint64 SpreadBits(uint64 X)
+		{
+			X &= 0x1fffff;
+			X = (X | X << 32) & 0x1f00000000ffff;
+			X = (X | X << 16) & 0x1f0000ff0000ff;
+			X = (X | X << 8) & 0x100f00f00f00f00f;
+			X = (X | X << 4) & 0x10c30c30c30c30c3;
+			X = (X | X << 2) & 0x1249249249249249;
+			return X;
+		}
+
+		FORCEINLINE static uint64 GetMortonKey(const uint32 X, const uint32 Y, const uint32 Z)
+		{
+			return SpreadBits(X) | SpreadBits(Y) << 1 | SpreadBits(Z) << 2;
+		}
+
+		/**
+		 * Hilbert index of a cell, using Skilling's transpose (AIP Conf. Proc. 707, 2004).
+		 * The transposed coordinates are then interleaved the same way as a Morton key.
+		 */
+		FORCEINLINE static uint64 GetHilbertKey(const uint32 X, const uint32 Y, const uint32 Z)
+		{
+			uint32 C[3] = {X, Y, Z};
+
+			// Inverse undo
+			for (uint32 Q = 1u << (Bits - 1); Q > 1; Q >>= 1)
+			{
+				const uint32 P = Q - 1;
+				for (int i = 0; i < 3; ++i)
+				{
+					if (C[i] & Q) { C[0] ^= P; }
+					else
+					{
+						const uint32 T = (C[0] ^ C[i]) & P;
+						C[0] ^= T;
+						C[i] ^= T;
+					}
+				}
+			}
+
+			// Gray encode
+			for (int i = 1; i < 3; ++i) { C[i] ^= C[i - 1]; }
+
+			uint32 T = 0;
+			for (uint32 Q = 1u << (Bits - 1); Q > 1; Q >>= 1) { if (C[2] & Q) { T ^= Q - 1; } }
+			for (int i = 0; i < 3; ++i) { C[i] ^= T; }
+
+			// First axis holds the most significant bit of each triplet
+			return GetMortonKey(C[2], C[1], C[0]);
+		}
+	}
+
+	/**
+	 * Computes a permutation of the input points that follows a space-filling curve, so consecutive items are spatially close.
+	 * @param InPoints Points to order
+	 * @param Order Curve to follow
+	 * @param OutOrder Point indices, in curve order. Identity if Order is None.
+	 */
+	static void ComputeSpatialOrder(const TArray<FPCGPoint>& InPoints, const EPCGExSpatialOrder Order, TArray<int32>& OutOrder)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExGeo::ComputeSpatialOrder);
+
+		const int32 NumPoints = InPoints.Num();
+		OutOrder.SetNumUninitialized(NumPoints);
+
+		if (Order == EPCGExSpatialOrder::None)
+		{
+			for (int i = 0; i < NumPoints; ++i) { OutOrder[i] = i; }
+			return;
+		}
+
+		FBox Bounds(ForceInit);
+		for (const FPCGPoint& Pt : InPoints) { Bounds += Pt.Transform.GetLocation(); }
+
+		constexpr double MaxCoord = (1 << SpatialOrder::Bits) - 1;
+		const FVector Size = Bounds.GetSize();
+		const FVector Scale = FVector(
+			Size.X > 0 ? MaxCoord / Size.X : 0,
+			Size.Y > 0 ? MaxCoord / Size.Y : 0,
+			Size.Z > 0 ? MaxCoord / Size.Z : 0);
+
+		TArray<TPair<uint64, int32>> Keys;
+		Keys.SetNumUninitialized(NumPoints);
+
+		// Serial : this runs inside each processor's own task, and the sort below dominates anyway
+		for (int i = 0; i < NumPoints; ++i)
+		{
+			const FVector Local = (InPoints[i].Transform.GetLocation() - Bounds.Min) * Scale;
+			const uint32 X = static_cast<uint32>(Local.X);
+			const uint32 Y = static_cast<uint32>(Local.Y);
+			const uint32 Z = static_cast<uint32>(Local.Z);
+
+			Keys[i] = TPair<uint64, int32>(
+				Order == EPCGExSpatialOrder::Hilbert ? SpatialOrder::GetHilbertKey(X, Y, Z) : SpatialOrder::GetMortonKey(X, Y, Z), i);
+		}
+
+		// Ties are broken by index, so the order is deterministic
+		Keys.Sort();
+
+		for (int i = 0; i < NumPoints; ++i) { OutOrder[i] = Keys[i].Value; }
+	}
+
+#pragma endregion
+}
@@ -0,0 +1,61 @@
+﻿// Copyright Timothé Lapetite 2024
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+namespace PCGEx
+{
+	class FIndexLookup;
+}
+
+namespace PCGExData
+{
+	struct FPointIO;
+}
+
+namespace PCGExCluster
+{
+	struct FCluster;
+}
+
+namespace PCGExClusterData
+{
+	/**
+	 * Optional on-disk cache of built cluster topology (CSR adjacency & edges), one file per cluster.
+	 * Files are keyed by point counts, the expected vtx adjacency and a CRC of the edge endpoints resolved to vtx point indices;
+	 * raw endpoints embed per-session data UIDs, resolved ones only depend on topology, so identical graphs hit across sessions.
+	 * Since the key doesn't cover content, every index is range-checked on load. Node positions are read from the vtx points.
+	 * Files are memory-mapped on load when the platform supports it, and the folder is trimmed by age & size.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FClusterDiskCache
+	{
+	public:
+		static FClusterDiskCache& Get();
+		static bool IsEnabled();
+
+		/** Hash of the vtx group, shared by every edge set bound to it. Never 0. */
+		static uint32 HashVtx(PCGExData::FPointIO* InVtxIO, const TArray<int32>& InExpectedAdjacency);
+
+		/** Cache key of an edge set. Returns 0 if the edges have no endpoints attribute or one doesn't resolve, in which case the cluster can't be built anyway. */
+		static uint64 HashEdges(const uint32 InVtxHash, PCGExData::FPointIO* InEdgesIO, const PCGEx::FIndexLookup& InEndpointsLookup);
+
+		/** Load a cluster previously saved under that key, or nullptr if there's none or it doesn't fit these inputs. */
+		PCGExCluster::FCluster* TryLoad(const uint64 Key, PCGExData::FPointIO* InVtxIO, PCGExData::FPointIO* InEdgesIO, const TArray<int32>* InExpectedAdjacency = nullptr) const;
+
+		void Save(const uint64 Key, const PCGExCluster::FCluster* InCluster) const;
+
+		/** Delete stale temp files & files past the max age, then least recently used ones until under the max size. */
+		void Trim() const;
+
+	protected:
+		FString CacheDir;
+		mutable FRWLock TrimLock;
+		mutable std::atomic<int64> BytesSinceTrim = 0;
+
+		FClusterDiskCache();
+		FString GetFilePath(const uint64 Key) const;
+	};
+}
@@ -84,9 +84,6 @@ namespace PCGExRelaxClusters
 
 		FPCGExInfluenceDetails InfluenceDetails;
 
-		bool bBuildExpandedNodes = false;
-		TArray<PCGExCluster::FExpandedNode*>* ExpandedNodes = nullptr;
-
 	public:
 		FProcessor(PCGExData::FPointIO* InVtx, PCGExData::FPointIO* InEdges):
 			FClusterProcessor(InVtx, InEdges)
@@ -98,9 +95,7 @@ namespace PCGExRelaxClusters
 		virtual PCGExCluster::FCluster* HandleCachedCluster(const PCGExCluster::FCluster* InClusterRef) override;
 		virtual bool Process(PCGExMT::FTaskManager* AsyncManager) override;
 		void StartRelaxIteration();
-		virtual void ProcessSingleRangeIteration(const int32 Iteration, const int32 LoopIdx, const int32 Count) override;
 		virtual void ProcessSingleNode(const int32 Index, PCGExCluster::FNode& Node, const int32 LoopIdx, const int32 Count) override;
-		virtual void CompleteWork() override;
 		virtual void Write() override;
 	};
 
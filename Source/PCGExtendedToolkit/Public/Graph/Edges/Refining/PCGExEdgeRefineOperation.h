@@ -19,8 +19,8 @@ class /*PCGEXTENDEDTOOLKIT_API*/ UPCGExEdgeRefineOperation : public UPCGExOperat
 public:
 	virtual bool SupportFilters() { return false; }
 	virtual bool GetDefaultEdgeValidity() { return true; }
-	virtual bool RequiresNodeOctree() { return false; }
-	virtual bool RequiresEdgeOctree() { return false; }
+	virtual bool RequiresNodeSpatialIndex() { return false; }
+	virtual bool RequiresEdgeSpatialIndex() { return false; }
 	virtual bool RequiresHeuristics() { return false; }
 	virtual bool RequiresIndividualNodeProcessing() { return false; }
 	virtual bool RequiresIndividualEdgeProcessing() { return false; }
@@ -33,8 +33,8 @@ public:
 		Cluster = InCluster;
 		Heuristics = InHeuristics;
 
-		if (RequiresNodeOctree()) { Cluster->RebuildOctree(EPCGExClusterClosestSearchMode::Node); }
-		if (RequiresEdgeOctree()) { Cluster->RebuildOctree(EPCGExClusterClosestSearchMode::Edge); }
+		if (RequiresNodeSpatialIndex()) { Cluster->RebuildSpatialIndex(EPCGExClusterClosestSearchMode::Node); }
+		if (RequiresEdgeSpatialIndex()) { Cluster->RebuildSpatialIndex(EPCGExClusterClosestSearchMode::Edge); }
 	}
 
 	virtual void Process()
@@ -25,7 +25,7 @@ class /*PCGEXTENDEDTOOLKIT_API*/ UPCGExEdgeRemoveOverlap : public UPCGExEdgeRefi
 
 public:
 	virtual bool RequiresIndividualEdgeProcessing() override { return true; }
-	virtual bool RequiresEdgeOctree() override { return true; }
+	virtual bool RequiresEdgeSpatialIndex() override { return true; }
 
 	virtual void PrepareForCluster(PCGExCluster::FCluster* InCluster, PCGExHeuristics::THeuristicsHandler* InHeuristics) override
 	{
@@ -55,11 +55,11 @@ public:
 		const PCGExCluster::FExpandedEdge* EEdge = *(Cluster->ExpandedEdges->GetData() + Edge.EdgeIndex);
 		const double Length = EEdge->GetEdgeLengthSquared(Cluster);
 
-		auto ProcessOverlap = [&](const PCGExCluster::FClusterItemRef& ItemRef)
+		auto ProcessOverlap = [&](const int32 OtherEdgeIndex)
 		{
 			//if (!Edge.bValid) { return false; }
 
-			const PCGExCluster::FExpandedEdge* OtherEEdge = *(Cluster->ExpandedEdges->GetData() + ItemRef.ItemIndex);
+			const PCGExCluster::FExpandedEdge* OtherEEdge = *(Cluster->ExpandedEdges->GetData() + OtherEdgeIndex);
 
 			if (EEdge == OtherEEdge ||
 				EEdge->Start == OtherEEdge->Start || EEdge->Start == OtherEEdge->End ||
@@ -99,7 +99,7 @@ public:
 			return true;
 		};
 
-		Cluster->EdgeOctree->FindFirstElementWithBoundsTest(FBoxCenterAndExtent(EEdge->Bounds), ProcessOverlap);
+		Cluster->EdgeBVH->FindOverlapping(EEdge->Bounds.GetBox(), ProcessOverlap);
 	}
 
 	//virtual void Process() override;
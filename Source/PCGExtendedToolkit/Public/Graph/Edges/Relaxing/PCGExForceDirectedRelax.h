@@ -26,19 +26,19 @@ public:
 		}
 	}
 
-	virtual void ProcessExpandedNode(const PCGExCluster::FExpandedNode* ExpandedNode) override
+	virtual void ProcessNode(const int32 NodeIndex) override
 	{
-		const FVector Position = *(ReadBuffer->GetData() + ExpandedNode->Node->NodeIndex);
+		const FVector Position = *(ReadBuffer->GetData() + NodeIndex);
 		FVector Force = FVector::Zero();
 
-		for (const PCGExCluster::FExpandedNeighbor& Neighbor : ExpandedNode->Neighbors)
+		for (const uint64 AdjacencyHash : Cluster->GetAdjacency(NodeIndex))
 		{
-			const FVector OtherPosition = *(ReadBuffer->GetData() + Neighbor.Node->NodeIndex);
+			const FVector OtherPosition = *(ReadBuffer->GetData() + PCGEx::H64A(AdjacencyHash));
 			CalculateAttractiveForce(Force, Position, OtherPosition);
 			CalculateRepulsiveForce(Force, Position, OtherPosition);
 		}
 
-		(*WriteBuffer)[ExpandedNode->Node->NodeIndex] = Position + Force;
+		(*WriteBuffer)[NodeIndex] = Position + Force;
 	}
 
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
@@ -16,16 +16,17 @@ class /*PCGEXTENDEDTOOLKIT_API*/ UPCGExLaplacianRelax : public UPCGExRelaxCluste
 	GENERATED_BODY()
 
 public:
-	virtual void ProcessExpandedNode(const PCGExCluster::FExpandedNode* ExpandedNode) override
+	virtual void ProcessNode(const int32 NodeIndex) override
 	{
-		const FVector Position = *(ReadBuffer->GetData() + ExpandedNode->Node->NodeIndex);
+		const FVector Position = *(ReadBuffer->GetData() + NodeIndex);
 		FVector Force = FVector::Zero();
 
-		for (const PCGExCluster::FExpandedNeighbor& Neighbor : ExpandedNode->Neighbors)
+		const TArrayView<const uint64> Adjacency = Cluster->GetAdjacency(NodeIndex);
+		for (const uint64 AdjacencyHash : Adjacency)
 		{
-			Force += (*(ReadBuffer->GetData() + Neighbor.Node->NodeIndex)) - Position;
+			Force += (*(ReadBuffer->GetData() + PCGEx::H64A(AdjacencyHash))) - Position;
 		}
 
-		(*WriteBuffer)[ExpandedNode->Node->NodeIndex] = Position + Force / static_cast<double>(ExpandedNode->Neighbors.Num());
+		(*WriteBuffer)[NodeIndex] = Position + Force / static_cast<double>(Adjacency.Num());
 	}
 };
@@ -38,14 +38,14 @@ public:
 	virtual void PrepareForCluster(PCGExCluster::FCluster* InCluster)
 	{
 		Cluster = InCluster;
+		Cluster->RebuildAdjacencyCSR();
 	}
 
-	virtual void ProcessExpandedNode(const PCGExCluster::FExpandedNode* ExpandedNode)
+	virtual void ProcessNode(const int32 NodeIndex)
 	{
 	}
 
 	PCGExCluster::FCluster* Cluster = nullptr;
-	TArray<PCGExCluster::FExpandedNode*>* ExpandedNodes = nullptr;
 	TArray<FVector>* ReadBuffer = nullptr;
 	TArray<FVector>* WriteBuffer = nullptr;
 
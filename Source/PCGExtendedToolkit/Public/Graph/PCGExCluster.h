@@ -1,4 +1,4 @@
-// Copyright Timothé Lapetite 2024
+﻿// Copyright Timothé Lapetite 2024
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #pragma once
@@ -9,6 +9,7 @@
 #include "PCGExGraph.h"
 #include "Data/PCGExAttributeHelpers.h"
 #include "Geometry/PCGExGeo.h"
+#include "Geometry/PCGExGeoSpatialIndex.h"
 
 #include "PCGExCluster.generated.h"
 
@@ -68,47 +69,6 @@ namespace PCGExCluster
 
 	PCGEX_ASYNC_STATE(State_ProcessingCluster)
 
-	struct /*PCGEXTENDEDTOOLKIT_API*/ FClusterItemRef
-	{
-		int32 ItemIndex;
-		FBoxSphereBounds Bounds;
-
-		FClusterItemRef(const int32 InItemIndex, const FBoxSphereBounds& InBounds)
-			: ItemIndex(InItemIndex), Bounds(InBounds)
-		{
-		}
-	};
-
-	struct /*PCGEXTENDEDTOOLKIT_API*/ FClusterItemRefSemantics
-	{
-		enum { MaxElementsPerLeaf = 16 };
-
-		enum { MinInclusiveElementsPerNode = 7 };
-
-		enum { MaxNodeDepth = 12 };
-
-		using ElementAllocator = TInlineAllocator<MaxElementsPerLeaf>;
-
-		FORCEINLINE static const FBoxSphereBounds& GetBoundingBox(const FClusterItemRef& InNode)
-		{
-			return InNode.Bounds;
-		}
-
-		FORCEINLINE static const bool AreElementsEqual(const FClusterItemRef& A, const FClusterItemRef& B)
-		{
-			return A.ItemIndex == B.ItemIndex;
-		}
-
-		FORCEINLINE static void ApplyOffset(FClusterItemRef& InNode)
-		{
-			ensureMsgf(false, TEXT("Not implemented"));
-		}
-
-		FORCEINLINE static void SetElementId(const FClusterItemRef& Element, FOctreeElementId2 OctreeElementID)
-		{
-		}
-	};
-
 	struct FCluster;
 
 	struct /*PCGEXTENDEDTOOLKIT_API*/ FNode : public PCGExGraph::FNode
@@ -164,6 +124,33 @@ namespace PCGExCluster
 		}
 	};
 
+	/**
+	 * Compressed sparse row view of cluster adjacency.
+	 * Neighbors of node i are Neighbors[Offsets[i] .. Offsets[i+1]), packed as H64(NeighborNodeIndex, EdgeIndex),
+	 * in the same order as FNode::Adjacency.
+	 * Only valid edges between valid nodes are stored, so rows of edited clusters may be shorter than FNode::Adjacency.
+	 */
+	struct /*PCGEXTENDEDTOOLKIT_API*/ FAdjacencyCSR
+	{
+		TArray<int32> Offsets;
+		TArray<uint64> Neighbors;
+
+		FAdjacencyCSR()
+		{
+		}
+
+		explicit FAdjacencyCSR(const FCluster* InCluster);
+
+		FORCEINLINE int32 Num(const int32 NodeIndex) const { return Offsets[NodeIndex + 1] - Offsets[NodeIndex]; }
+		FORCEINLINE TArrayView<const uint64> Get(const int32 NodeIndex) const
+		{
+			const int32 Start = Offsets[NodeIndex];
+			return TArrayView<const uint64>(Neighbors.GetData() + Start, Offsets[NodeIndex + 1] - Start);
+		}
+
+		SIZE_T GetAllocatedSize() const { return Offsets.GetAllocatedSize() + Neighbors.GetAllocatedSize(); }
+	};
+
 	struct /*PCGEXTENDEDTOOLKIT_API*/ FCluster
 	{
 	protected:
@@ -171,14 +158,16 @@ namespace PCGExCluster
 		bool bOwnsNodes = true;
 		bool bOwnsEdges = true;
 		bool bOwnsNodeIndexLookup = true;
-		bool bOwnsNodeOctree = true;
-		bool bOwnsEdgeOctree = true;
+		bool bOwnsNodeKDTree = true;
+		bool bOwnsEdgeBVH = true;
+		bool bOwnsAdjacencyCSR = true;
 		bool bOwnsLengths = true;
 		bool bOwnsVtxPointIndices = true;
 		bool bOwnsExpandedNodes = true;
 		bool bOwnsExpandedEdges = true;
 
 		bool bEdgeLengthsDirty = true;
+		bool bEdgeLengthsNormalized = false;
 		bool bIsCopyCluster = false;
 		TArray<int32>* VtxPointIndices = nullptr;
 		TArray<uint64>* VtxPointScopes = nullptr;
@@ -193,7 +182,7 @@ namespace PCGExCluster
 		bool bIsOneToOne = false; // Whether the input data has a single set of edges for a single set of vtx
 
 		int32 ClusterID = -1;
-		TMap<int32, int32>* NodeIndexLookup = nullptr; // Node index -> Point Index
+		PCGEx::FIndexLookup* NodeIndexLookup = nullptr; // Point Index -> Node index
 		//TMap<uint64, int32> EdgeIndexLookup;   // Edge Hash -> Edge Index
 		TArray<FNode>* Nodes = nullptr;
 		TArray<FExpandedNode*>* ExpandedNodes = nullptr;
@@ -207,9 +196,9 @@ namespace PCGExCluster
 		PCGExData::FPointIO* VtxIO = nullptr;
 		PCGExData::FPointIO* EdgesIO = nullptr;
 
-		using ClusterItemOctree = TOctree2<FClusterItemRef, FClusterItemRefSemantics>;
-		ClusterItemOctree* NodeOctree = nullptr;
-		ClusterItemOctree* EdgeOctree = nullptr;
+		PCGExGeo::FKDTree* NodeKDTree = nullptr; // Items are node indices
+		PCGExGeo::FBVH* EdgeBVH = nullptr;       // Items are edge indices
+		FAdjacencyCSR* AdjacencyCSR = nullptr;   // Optional, see RebuildAdjacencyCSR
 
 		FCluster();
 		FCluster(const FCluster* OtherCluster, PCGExData::FPointIO* InVtxIO, PCGExData::FPointIO* InEdgesIO,
@@ -224,11 +213,18 @@ namespace PCGExCluster
 		bool BuildFrom(
 			const PCGExData::FPointIO* EdgeIO,
 			const TArray<FPCGPoint>& InNodePoints,
-			const TMap<uint32, int32>& InEndpointsLookup,
+			const PCGEx::FIndexLookup& InEndpointsLookup,
 			const TArray<int32>* InExpectedAdjacency = nullptr);
 
 		void BuildFrom(const PCGExGraph::FSubGraph* SubGraph);
 
+		/**
+		 * Build from a cluster edited in place, once its subgraph has been compiled.
+		 * Copies the source topology, dropping invalid items and remapping to the compiled vtx & edge points;
+		 * adjacency is carried over instead of being rebuilt from edges.
+		 */
+		void BuildFrom(const FCluster* InSourceCluster, const PCGExGraph::FSubGraph* SubGraph);
+
 		bool IsValidWith(const PCGExData::FPointIO* InVtxIO, const PCGExData::FPointIO* InEdgesIO) const;
 
 		const TArray<uint64>* GetVtxPointScopesPtr();
@@ -277,21 +273,51 @@ namespace PCGExCluster
 
 		FORCEINLINE FVector GetDir(const FNode& From, const FNode& To) const { return GetDir(From.NodeIndex, To.NodeIndex); }
 
-		void RebuildNodeOctree();
-		void RebuildEdgeOctree();
-		void RebuildOctree(EPCGExClusterClosestSearchMode Mode, const bool bForceRebuild = false);
+		void RebuildNodeKDTree();
+		void RebuildEdgeBVH();
+		void RebuildSpatialIndex(EPCGExClusterClosestSearchMode Mode, const bool bForceRebuild = false);
+
+		/** Pack adjacency into a single CSR block. Traversal-heavy consumers read it through GetAdjacency. Not thread-safe; build before going wide. */
+		void RebuildAdjacencyCSR(const bool bForceRebuild = false);
+
+		FORCEINLINE TArrayView<const uint64> GetAdjacency(const int32 NodeIndex) const
+		{
+			if (AdjacencyCSR) { return AdjacencyCSR->Get(NodeIndex); }
+			return TArrayView<const uint64>((Nodes->GetData() + NodeIndex)->Adjacency);
+		}
 
 		int32 FindClosestNode(const FVector& Position, EPCGExClusterClosestSearchMode Mode, const int32 MinNeighbors = 0) const;
 		int32 FindClosestNode(const FVector& Position, const int32 MinNeighbors = 0) const;
 		int32 FindClosestNodeFromEdge(const FVector& Position, const int32 MinNeighbors = 0) const;
 
 		int32 FindClosestEdge(const int32 InNodeIndex, const FVector& InPosition) const;
+		int32 FindClosestEdge(const FVector& Position, double& OutDistSquared) const;
+
+		void FindKClosestNodes(const FVector& Position, const int32 K, TArray<int32>& OutNodeIndices, const int32 MinNeighbors = 0) const;
+		void FindNodesInRadius(const FVector& Position, const double Radius, TArray<int32>& OutNodeIndices, const int32 MinNeighbors = 0) const;
 
 		int32 FindClosestNeighbor(const int32 NodeIndex, const FVector& Position, int32 MinNeighborCount = 1) const;
 		int32 FindClosestNeighbor(const int32 NodeIndex, const FVector& Position, const TSet<int32>& Exclusion, int32 MinNeighborCount = 1) const;
 
 		void ComputeEdgeLengths(bool bNormalize = false);
 
+		/**
+		 * In-place topology edits.
+		 * Edge & node indices are stable : removed items are flagged invalid and stripped from adjacency, added edges are appended.
+		 * The node KD-tree & edge BVH are kept and filter removed items at query time. Raw edge lengths are appended to,
+		 * normalized ones are dropped and recomputed on demand. None of these are thread-safe.
+		 */
+		void WillModifyTopology();
+		void RemoveEdges(const TArrayView<const int32> InEdgeIndices);
+		void RemoveNodes(const TArrayView<const int32> InNodeIndices);
+		int32 AddEdge(const int32 NodeA, const int32 NodeB);
+
+		/** Strip edges that have been flagged invalid (i.e by a refinement) from adjacency. Returns the number of edges still valid. */
+		int32 RemoveInvalidEdges();
+
+		/** Whether every valid node with at least one edge can be reached from any other one. */
+		bool IsConnected() const;
+
 		void GetConnectedNodes(const int32 FromIndex, TArray<int32>& OutIndices, const int32 SearchDepth) const;
 		void GetConnectedNodes(const int32 FromIndex, TArray<int32>& OutIndices, const int32 SearchDepth, const TSet<int32>& Skip) const;
 
@@ -331,12 +357,13 @@ namespace PCGExCluster
 		void GrabNeighbors(const int32 NodeIndex, TArray<T>& OutNeighbors, const MakeFunc&& Make) const
 		{
 			FNode* Node = (Nodes->GetData() + NodeIndex);
-			PCGEX_SET_NUM_UNINITIALIZED(OutNeighbors, Node->Adjacency.Num())
-			for (int i = 0; i < Node->Adjacency.Num(); ++i)
+			const TArrayView<const uint64> Adjacency = GetAdjacency(NodeIndex);
+			PCGEX_SET_NUM_UNINITIALIZED(OutNeighbors, Adjacency.Num())
+			for (int i = 0; i < Adjacency.Num(); ++i)
 			{
 				uint32 OtherNodeIndex;
 				uint32 EdgeIndex;
-				PCGEx::H64(Node->Adjacency[i], OtherNodeIndex, EdgeIndex);
+				PCGEx::H64(Adjacency[i], OtherNodeIndex, EdgeIndex);
 				OutNeighbors[i] = Make(Node, (Nodes->GetData() + OtherNodeIndex), (Edges->GetData() + EdgeIndex));
 			}
 		}
@@ -344,12 +371,13 @@ namespace PCGExCluster
 		template <typename T, class MakeFunc>
 		void GrabNeighbors(const FNode& Node, TArray<T>& OutNeighbors, const MakeFunc&& Make) const
 		{
-			PCGEX_SET_NUM_UNINITIALIZED(OutNeighbors, Node.Adjacency.Num())
-			for (int i = 0; i < Node.Adjacency.Num(); ++i)
+			const TArrayView<const uint64> Adjacency = GetAdjacency(Node.NodeIndex);
+			PCGEX_SET_NUM_UNINITIALIZED(OutNeighbors, Adjacency.Num())
+			for (int i = 0; i < Adjacency.Num(); ++i)
 			{
 				uint32 OtherNodeIndex;
 				uint32 EdgeIndex;
-				PCGEx::H64(Node.Adjacency[i], OtherNodeIndex, EdgeIndex);
+				PCGEx::H64(Adjacency[i], OtherNodeIndex, EdgeIndex);
 				OutNeighbors[i] = Make((Nodes->GetData() + OtherNodeIndex), (Edges->GetData() + EdgeIndex));
 			}
 		}
@@ -523,7 +551,7 @@ namespace PCGExClusterTask
 			PCGExData::FPointIO* InPointIO,
 			PCGExCluster::FCluster* InCluster,
 			const PCGExData::FPointIO* InEdgeIO,
-			const TMap<uint32, int32>* InEndpointsLookup,
+			const PCGEx::FIndexLookup* InEndpointsLookup,
 			const TArray<int32>* InExpectedAdjacency) :
 			FPCGExTask(InPointIO),
 			Cluster(InCluster),
@@ -535,7 +563,7 @@ namespace PCGExClusterTask
 
 		PCGExCluster::FCluster* Cluster = nullptr;
 		const PCGExData::FPointIO* EdgeIO = nullptr;
-		const TMap<uint32, int32>* EndpointsLookup = nullptr;
+		const PCGEx::FIndexLookup* EndpointsLookup = nullptr;
 		const TArray<int32>* ExpectedAdjacency = nullptr;
 
 		virtual bool ExecuteTask() override;
@@ -618,10 +646,12 @@ namespace PCGExClusterTask
 				break;
 			}
 
+			const TArrayView<const uint64> Adjacency = Cluster->GetAdjacency(NextIndex);
+
 			uint32 OtherIndex;
 			uint32 EdgeIndex;
-			PCGEx::H64(NextNode.Adjacency[0], OtherIndex, EdgeIndex);                                  // Get next node
-			if (OtherIndex == LastIndex) { PCGEx::H64(NextNode.Adjacency[1], OtherIndex, EdgeIndex); } // Get other next
+			PCGEx::H64(Adjacency[0], OtherIndex, EdgeIndex);                                  // Get next node
+			if (OtherIndex == LastIndex) { PCGEx::H64(Adjacency[1], OtherIndex, EdgeIndex); } // Get other next
 
 			LastIndex = NextIndex;
 			NextIndex = OtherIndex;
@@ -9,6 +9,7 @@
 #include "PCGExGraph.h"
 #include "PCGExCluster.h"
 #include "Data/PCGExClusterData.h"
+#include "Data/PCGExClusterDiskCache.h"
 #include "Data/PCGExData.h"
 #include "Pathfinding/Heuristics/PCGExHeuristics.h"
 
@@ -100,8 +101,9 @@ namespace PCGExClusterMT
 		PCGExData::FPointIO* EdgesIO = nullptr;
 		int32 BatchIndex = -1;
 
-		TMap<uint32, int32>* EndpointsLookup = nullptr;
+		PCGEx::FIndexLookup* EndpointsLookup = nullptr;
 		TArray<int32>* ExpectedAdjacency = nullptr;
+		uint32 VtxContentHash = 0; // Non-zero when the on-disk cluster cache is enabled
 
 		PCGExCluster::FCluster* Cluster = nullptr;
 
@@ -146,6 +148,17 @@ namespace PCGExClusterMT
 				Cluster = HandleCachedCluster(CachedCluster);
 			}
 
+			uint64 DiskCacheKey = 0;
+			if (!Cluster && VtxContentHash != 0)
+			{
+				DiskCacheKey = PCGExClusterData::FClusterDiskCache::HashEdges(VtxContentHash, EdgesIO, *EndpointsLookup);
+				if (DiskCacheKey != 0)
+				{
+					Cluster = PCGExClusterData::FClusterDiskCache::Get().TryLoad(DiskCacheKey, VtxIO, EdgesIO, ExpectedAdjacency);
+					if (Cluster) { Cluster->bIsOneToOne = bIsOneToOne; }
+				}
+			}
+
 			if (!Cluster)
 			{
 				Cluster = new PCGExCluster::FCluster();
@@ -158,6 +171,8 @@ namespace PCGExClusterMT
 					PCGEX_DELETE(Cluster)
 					return false;
 				}
+
+				if (DiskCacheKey != 0) { PCGExClusterData::FClusterDiskCache::Get().Save(DiskCacheKey, Cluster); }
 			}
 
 			NumNodes = Cluster->Nodes->Num();
@@ -191,6 +206,7 @@ namespace PCGExClusterMT
 			const int32 PLI = GetDefault<UPCGExGlobalSettings>()->GetClusterBatchChunkSize(PerLoopIterations);
 
 			PCGEX_ASYNC_GROUP_CHECKED(AsyncManagerPtr, ParallelLoopForNodes)
+			ParallelLoopForNodes->SetAdaptiveChunkSize();
 			ParallelLoopForNodes->SetOnCompleteCallback([&]() { OnNodesProcessingComplete(); });
 			ParallelLoopForNodes->SetOnIterationRangePrepareCallback([&](const TArray<uint64>& Loops) { PrepareLoopScopesForNodes(Loops); });
 			ParallelLoopForNodes->SetOnIterationRangeStartCallback(
@@ -239,6 +255,7 @@ namespace PCGExClusterMT
 			const int32 PLI = GetDefault<UPCGExGlobalSettings>()->GetClusterBatchChunkSize(PerLoopIterations);
 
 			PCGEX_ASYNC_GROUP_CHECKED(AsyncManagerPtr, ParallelLoopForEdges)
+			ParallelLoopForEdges->SetAdaptiveChunkSize();
 			ParallelLoopForEdges->SetOnCompleteCallback([&]() { OnEdgesProcessingComplete(); });
 			ParallelLoopForEdges->SetOnIterationRangePrepareCallback([&](const TArray<uint64>& Loops) { PrepareLoopScopesForEdges(Loops); });
 			ParallelLoopForEdges->SetOnIterationRangeStartCallback(
@@ -286,6 +303,7 @@ namespace PCGExClusterMT
 			const int32 PLI = GetDefault<UPCGExGlobalSettings>()->GetClusterBatchChunkSize(PerLoopIterations);
 
 			PCGEX_ASYNC_GROUP_CHECKED(AsyncManagerPtr, ParallelLoopForRanges)
+			ParallelLoopForRanges->SetAdaptiveChunkSize();
 			ParallelLoopForRanges->SetOnCompleteCallback([&]() { OnRangeProcessingComplete(); });
 			ParallelLoopForRanges->SetOnIterationRangePrepareCallback([&](const TArray<uint64>& Loops) { PrepareLoopScopesForRanges(Loops); });
 			ParallelLoopForRanges->SetOnIterationRangeStartCallback(
@@ -338,8 +356,9 @@ namespace PCGExClusterMT
 		const FPCGMetadataAttribute<int64>* RawLookupAttribute = nullptr;
 		TArray<uint32> ReverseLookup;
 
-		TMap<uint32, int32> EndpointsLookup;
+		PCGEx::FIndexLookup EndpointsLookup;
 		TArray<int32> ExpectedAdjacency;
+		uint32 VtxContentHash = 0;
 
 		bool bPreparationSuccessful = false;
 		bool bRequiresHeuristics = false;
@@ -431,9 +450,7 @@ namespace PCGExClusterMT
 					{
 						TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExGraph::BuildLookupTable::Complete);
 
-						const int32 Num = VtxIO->GetNum();
-						EndpointsLookup.Reserve(Num);
-						for (int i = 0; i < Num; i++) { EndpointsLookup.Add(ReverseLookup[i], i); }
+						EndpointsLookup.InitFromKeys(ReverseLookup);
 						ReverseLookup.Empty();
 
 						if (RequiresGraphBuilder())
@@ -468,6 +485,7 @@ namespace PCGExClusterMT
 
 		virtual void OnProcessingPreparationComplete()
 		{
+			if (PCGExClusterData::FClusterDiskCache::IsEnabled()) { VtxContentHash = PCGExClusterData::FClusterDiskCache::HashVtx(VtxIO, ExpectedAdjacency); }
 			Process();
 		}
 
@@ -542,6 +560,7 @@ namespace PCGExClusterMT
 				NewProcessor->Context = Context;
 				NewProcessor->EndpointsLookup = &EndpointsLookup;
 				NewProcessor->ExpectedAdjacency = &ExpectedAdjacency;
+				NewProcessor->VtxContentHash = VtxContentHash;
 				NewProcessor->BatchIndex = Processors.Add(NewProcessor);
 				NewProcessor->VtxDataFacade = VtxDataFacade;
 
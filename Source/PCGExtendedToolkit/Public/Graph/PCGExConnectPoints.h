@@ -6,6 +6,7 @@
 #include "CoreMinimal.h"
 #include "PCGExPointsProcessor.h"
 #include "Geometry/PCGExGeo.h"
+#include "Geometry/PCGExGeoSpatialIndex.h"
 #include "Graph/PCGExGraph.h"
 #include "PCGExConnectPoints.generated.h"
 
@@ -102,6 +103,9 @@ protected:
 
 namespace PCGExConnectPoints
 {
+	// Variable radii are served by the hash grid as long as the largest one is within this factor of the average
+	constexpr double GridMaxRadiusSpread = 2;
+
 	struct /*PCGEXTENDEDTOOLKIT_API*/ FPositionRef
 	{
 		int32 Index;
@@ -161,6 +165,8 @@ namespace PCGExConnectPoints
 
 		TArray<bool> CanGenerate;
 		PositionOctree* Octree = nullptr;
+		const PCGExGeo::FPointHashGrid* Grid = nullptr;
+		bool bSharedGrid = false;
 
 		const TArray<FPCGPoint>* InPoints = nullptr;
 		TArray<FTransform> CachedTransforms;
@@ -182,8 +188,9 @@ namespace PCGExConnectPoints
 
 		virtual bool Process(PCGExMT::FTaskManager* AsyncManager) override;
 		void OnPreparationComplete();
+		double GetSearchRadius(const int32 Index) const;
 		virtual void PrepareLoopScopesForPoints(const TArray<uint64>& Loops) override;
-		virtual void ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const int32 LoopIdx, const int32 Count) override;
+		virtual void ProcessSingleInPoint(const int32 Index, const FPCGPoint& Point, const int32 LoopIdx, const int32 Count) override;
 		virtual void CompleteWork() override;
 		virtual void Write() override;
 	};
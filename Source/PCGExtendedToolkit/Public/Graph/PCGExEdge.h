@@ -170,7 +170,7 @@ namespace PCGExGraph
 
 	static bool BuildIndexedEdges(
 		const PCGExData::FPointIO* EdgeIO,
-		const TMap<uint32, int32>& EndpointsLookup,
+		const PCGEx::FIndexLookup& EndpointsLookup,
 		TArray<FIndexedEdge>& OutEdges,
 		const bool bStopOnError = false)
 	{
@@ -237,7 +237,7 @@ namespace PCGExGraph
 
 	static bool BuildIndexedEdges(
 		const PCGExData::FPointIO* EdgeIO,
-		const TMap<uint32, int32>& EndpointsLookup,
+		const PCGEx::FIndexLookup& EndpointsLookup,
 		TArray<FIndexedEdge>& OutEdges,
 		TSet<int32>& OutNodePoints,
 		const bool bStopOnError = false)
@@ -57,7 +57,7 @@ struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExEdgesProcessorContext : public FPCGExPoi
 
 	PCGExData::FPointIOTaggedDictionary* InputDictionary = nullptr;
 	PCGExData::FPointIOTaggedEntries* TaggedEdges = nullptr;
-	TMap<uint32, int32> EndpointsLookup;
+	PCGEx::FIndexLookup EndpointsLookup;
 	TArray<int32> EndpointsAdjacency;
 
 	virtual bool AdvancePointsIO(const bool bCleanupKeys = true) override;
@@ -309,12 +309,13 @@ namespace PCGExGraph
 	{
 		int64 Id = -1;
 		FGraph* ParentGraph = nullptr;
-		TSet<int32> Nodes;
-		TSet<int32> Edges; //TODO : Test for TArray
-		TSet<int32> EdgesInIOIndices;
+		TArrayView<const int32> Nodes; // Slice of ParentGraph->SubGraphNodes, ascending
+		TArrayView<const int32> Edges; // Slice of ParentGraph->SubGraphEdges, ascending
+		int32 FirstInIOIndex = -1;
 		PCGExData::FPointIO* VtxIO = nullptr;
 		PCGExData::FPointIO* EdgesIO = nullptr;
 		TArray<FIndexedEdge> FlattenedEdges;
+		const PCGExCluster::FCluster* SourceCluster = nullptr; // Edited cluster this subgraph was built from, if any
 
 		FSubGraph()
 		{
@@ -322,22 +323,11 @@ namespace PCGExGraph
 
 		~FSubGraph()
 		{
-			Nodes.Empty();
-			Edges.Empty();
 			FlattenedEdges.Empty();
-			EdgesInIOIndices.Empty();
 			VtxIO = nullptr;
 			EdgesIO = nullptr;
 		}
 
-		FORCEINLINE void Add(const FIndexedEdge& Edge, FGraph* InGraph)
-		{
-			Nodes.Add(Edge.Start);
-			Nodes.Add(Edge.End);
-			Edges.Add(Edge.EdgeIndex);
-			if (Edge.IOIndex >= 0) { EdgesInIOIndices.Add(Edge.IOIndex); }
-		}
-
 		void Invalidate(FGraph* InGraph);
 		PCGExCluster::FCluster* CreateCluster(PCGExMT::FTaskManager* AsyncManager) const;
 		int32 GetFirstInIOIndex();
@@ -362,6 +352,8 @@ namespace PCGExGraph
 		TSet<uint64> UniqueEdges;
 
 		TArray<FSubGraph*> SubGraphs;
+		TArray<int32> SubGraphNodes; // Node indices bucketed per subgraph
+		TArray<int32> SubGraphEdges; // Edge indices bucketed per subgraph
 
 		bool bWriteEdgePosition = true;
 		double EdgePosition = 0.5;
@@ -398,8 +390,15 @@ namespace PCGExGraph
 
 		TArrayView<FNode> AddNodes(const int32 NumNewNodes);
 
+		/** Find connected components with a union-find and bucket them into flat per-subgraph slices. Call once. */
 		void BuildSubGraphs(const FPCGExGraphBuilderDetails& Limits);
 
+		/** Same as above, with the union & flatten passes run as parallel ranges on the given manager. OnComplete is called once subgraphs are built. */
+		void BuildSubGraphs(PCGExMT::FTaskManager* AsyncManager, const FPCGExGraphBuilderDetails& Limits, PCGExMT::FTaskGroup::CompletionCallback&& OnComplete);
+
+		/** Stage the valid edges of a single, connected, edited cluster as the one subgraph, skipping edge dedupe & component search. Expects an empty graph. */
+		void BuildSubGraph(const PCGExCluster::FCluster* InCluster, const FPCGExGraphBuilderDetails& Limits);
+
 		void ForEachCluster(TFunction<void(FSubGraph*)>&& Func)
 		{
 			for (FSubGraph* Cluster : SubGraphs)
@@ -420,9 +419,21 @@ namespace PCGExGraph
 
 			for (const FSubGraph* Cluster : SubGraphs) { delete Cluster; }
 			SubGraphs.Empty();
+			SubGraphNodes.Empty();
+			SubGraphEdges.Empty();
 		}
 
 		void GetConnectedNodes(int32 FromIndex, TArray<int32>& OutIndices, int32 SearchDepth) const;
+
+	protected:
+		// Scratch state of BuildSubGraphs
+		TArray<int32> ComponentParents;
+		TBitArray<> ExportedEdges;
+
+		void PrepareComponents();
+		void UnionComponents(const int32 StartIndex, const int32 Count);
+		void FlattenComponents(const int32 StartIndex, const int32 Count);
+		void BucketSubGraphs(const FPCGExGraphBuilderDetails& Limits);
 	};
 
 	class /*PCGEXTENDEDTOOLKIT_API*/ FGraphBuilder
@@ -443,6 +454,9 @@ namespace PCGExGraph
 
 		PCGExData::FFacade* VtxDataFacade = nullptr;
 
+		// When set, Compile outputs this cluster as-is instead of searching the graph for subgraphs. Not owned.
+		const PCGExCluster::FCluster* SourceCluster = nullptr;
+
 		bool bCompiledSuccessfully = false;
 
 		FGraphBuilder(PCGExData::FPointIO* InPointIO, const FPCGExGraphBuilderDetails* InDetails, const int32 NumEdgeReserve = 6, PCGExData::FPointIOCollection* InSourceEdges = nullptr)
@@ -469,6 +483,9 @@ namespace PCGExGraph
 		void CompileAsync(PCGExMT::FTaskManager* AsyncManager, FGraphMetadataDetails* MetadataDetails = nullptr);
 		void Compile(PCGExMT::FTaskManager* AsyncManager, FGraphMetadataDetails* MetadataDetails = nullptr);
 
+		/** Everything Compile does once subgraphs are built : prune points, write endpoints & start writing edges. */
+		void CompileSubGraphs(PCGExMT::FTaskManager* AsyncManager, FGraphMetadataDetails* MetadataDetails = nullptr);
+
 		void Write() const;
 
 		~FGraphBuilder()
@@ -481,7 +498,7 @@ namespace PCGExGraph
 
 	static bool BuildEndpointsLookup(
 		const PCGExData::FPointIO* InPointIO,
-		TMap<uint32, int32>& OutIndices,
+		PCGEx::FIndexLookup& OutIndices,
 		TArray<int32>& OutAdjacency)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExGraph::BuildLookupTable);
@@ -496,17 +513,21 @@ namespace PCGExGraph
 			return false;
 		}
 
-		OutIndices.Reserve(IndexReader->Values.Num());
+		TArray<uint32> Keys;
+		PCGEX_SET_NUM_UNINITIALIZED(Keys, IndexReader->Values.Num())
+
 		for (int i = 0; i < IndexReader->Values.Num(); ++i)
 		{
 			uint32 A;
 			uint32 B;
 			PCGEx::H64(IndexReader->Values[i], A, B);
 
-			OutIndices.Add(A, i);
+			Keys[i] = A;
 			OutAdjacency[i] = B;
 		}
 
+		OutIndices.InitFromKeys(Keys);
+
 		PCGEX_DELETE(IndexReader)
 		return true;
 	}
@@ -541,7 +562,7 @@ namespace PCGExGraph
 		return true;
 	}
 
-	static bool GetReducedVtxIndices(PCGExData::FPointIO* InEdges, const TMap<uint32, int32>* NodeIndicesMap, TArray<int32>& OutVtxIndices, int32& OutEdgeNum)
+	static bool GetReducedVtxIndices(PCGExData::FPointIO* InEdges, const PCGEx::FIndexLookup* NodeIndicesMap, TArray<int32>& OutVtxIndices, int32& OutEdgeNum)
 	{
 		PCGEx::TAttributeReader<int64>* EndpointsReader = new PCGEx::TAttributeReader<int64>(Tag_EdgeEndpoints);
 
@@ -157,12 +157,14 @@ namespace PCGExGraph
 	{
 	protected:
 		mutable FRWLock AdjacencyLock;
+		mutable FRWLock PointLock;
 
 	public:
-		const FPCGPoint Point;
+		FPCGPoint Point;
 		FVector Center;
 		FBoxSphereBounds Bounds;
 		int32 Index;
+		uint64 FirstHash = MAX_uint64; // H64(IOIndex, PointIndex) of the point currently held in Point
 
 		TSet<int32> Adjacency;
 
@@ -187,6 +189,39 @@ namespace PCGExGraph
 			FWriteScopeLock WriteScopeLock(AdjacencyLock);
 			Adjacency.Add(InAdjacency);
 		}
+
+		/** Keep the lowest-ranked source point as the node's representative, regardless of insertion order. */
+		FORCEINLINE void Represent(const FPCGPoint& InPoint, const uint64 InHash)
+		{
+			FWriteScopeLock WriteScopeLock(PointLock);
+			if (InHash >= FirstHash) { return; }
+
+			FirstHash = InHash;
+			Point = InPoint;
+			Center = InPoint.Transform.GetLocation();
+			Bounds = FBoxSphereBounds(InPoint.GetLocalBounds().TransformBy(InPoint.Transform));
+		}
+	};
+
+	/** One slice of the voxel grid. Owns the nodes & compounds it creates until the graph is finalized. */
+	struct /*PCGEXTENDEDTOOLKIT_API*/ FCompoundGridShard
+	{
+		mutable FRWLock ShardLock;
+
+		TMap<FInt64Vector3, int32> Cells;
+		TArray<FCompoundNode*> Nodes;
+		TArray<PCGExData::FIdxCompound*> Compounds;
+
+		FCompoundGridShard()
+		{
+		}
+
+		~FCompoundGridShard()
+		{
+			PCGEX_DELETE_TARRAY(Nodes)
+			PCGEX_DELETE_TARRAY(Compounds)
+			Cells.Empty();
+		}
 	};
 
 	struct /*PCGEXTENDEDTOOLKIT_API*/ FCompoundNodeSemantics
@@ -221,7 +256,12 @@ namespace PCGExGraph
 
 	struct /*PCGEXTENDEDTOOLKIT_API*/ FCompoundGraph
 	{
-		TMap<uint32, FCompoundNode*> GridTree;
+		// Voxel nodes are spread across shards picked from the high bits of PCGEx::GH64.
+		// Until Finalize(), a grid node's Index is provisional : (LocalIndex << GridShardBits) | ShardIndex
+		static constexpr int32 GridShardBits = 6;
+		static constexpr int32 NumGridShards = 1 << GridShardBits;
+		TArray<FCompoundGridShard*> GridShards;
+		bool bFinalized = false;
 
 		PCGExData::FIdxCompoundList* PointsCompounds = nullptr;
 		PCGExData::FIdxCompoundList* EdgesCompounds = nullptr;
@@ -251,6 +291,11 @@ namespace PCGExGraph
 			EdgesCompounds = new PCGExData::FIdxCompoundList();
 
 			if (InFuseDetails.FuseMethod == EPCGExFuseMethod::Octree) { Octree = new NodeOctree(Bounds.GetCenter(), Bounds.GetExtent().Length() + 10); }
+			else
+			{
+				GridShards.SetNumUninitialized(NumGridShards);
+				for (FCompoundGridShard*& Shard : GridShards) { Shard = new FCompoundGridShard(); }
+			}
 		}
 
 		~FCompoundGraph()
@@ -259,6 +304,7 @@ namespace PCGExGraph
 			PCGEX_DELETE(PointsCompounds)
 			PCGEX_DELETE(EdgesCompounds)
 			PCGEX_DELETE(Octree)
+			PCGEX_DELETE_TARRAY(GridShards)
 			Edges.Empty();
 		}
 
@@ -267,12 +313,21 @@ namespace PCGExGraph
 
 		FCompoundNode* InsertPoint(const FPCGPoint& Point, const int32 IOIndex, const int32 PointIndex);
 		FCompoundNode* InsertPointUnsafe(const FPCGPoint& Point, const int32 IOIndex, const int32 PointIndex);
+		FCompoundNode* InsertGridPoint(const FPCGPoint& Point, const int32 IOIndex, const int32 PointIndex);
 		PCGExData::FIdxCompound* InsertEdge(const FPCGPoint& From, const int32 FromIOIndex, const int32 FromPointIndex,
 		                                    const FPCGPoint& To, const int32 ToIOIndex, const int32 ToPointIndex,
 		                                    const int32 EdgeIOIndex = -1, const int32 EdgePointIndex = -1);
 		PCGExData::FIdxCompound* InsertEdgeUnsafe(const FPCGPoint& From, const int32 FromIOIndex, const int32 FromPointIndex,
 		                                          const FPCGPoint& To, const int32 ToIOIndex, const int32 ToPointIndex,
 		                                          const int32 EdgeIOIndex = -1, const int32 EdgePointIndex = -1);
+
+		/**
+		 * Must be called once insertion is complete and before Nodes, PointsCompounds or Edges are read.
+		 * In voxel mode, gathers shard nodes and assigns their final indices in source-point order so the output
+		 * does not depend on thread interleaving; adjacency, edges & compounds are remapped accordingly.
+		 */
+		void Finalize();
+
 		void GetUniqueEdges(TSet<uint64>& OutEdges);
 		void WriteMetadata(TMap<int32, FGraphNodeMetadata*>& OutMetadata);
 	};
@@ -69,7 +69,7 @@ class /*PCGEXTENDEDTOOLKIT_API*/ FPCGExPackClusterTask final : public PCGExMT::F
 public:
 	FPCGExPackClusterTask(PCGExData::FPointIO* InPointIO,
 	                      PCGExData::FPointIO* InInEdges,
-	                      const TMap<uint32, int32>& InEndpointsLookup) :
+	                      const PCGEx::FIndexLookup& InEndpointsLookup) :
 		FPCGExTask(InPointIO),
 		InEdges(InInEdges),
 		EndpointsLookup(InEndpointsLookup)
@@ -82,7 +82,7 @@ public:
 	}
 
 	PCGExData::FPointIO* InEdges = nullptr;
-	TMap<uint32, int32> EndpointsLookup;
+	PCGEx::FIndexLookup EndpointsLookup;
 
 	virtual bool ExecuteTask() override;
 };
@@ -130,7 +130,7 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Tagging & Forwarding", meta=(EditCondition="bFlagDeadEnds"))
 	FName DeadEndAttributeName = TEXT("IsDeadEnd");
 
-	/** Whether or not to search for closest node using an octree. Depending on your dataset, enabling this may be either much faster, or much slower. */
+	/** Whether or not to search for closest node using a spatial index (KD-tree for nodes, BVH for edges). Building the index has a cost, which pays off as the number of seeds & goals grows. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Performance", meta=(PCG_NotOverridable, AdvancedDisplay))
 	bool bUseOctreeSearch = false;
 
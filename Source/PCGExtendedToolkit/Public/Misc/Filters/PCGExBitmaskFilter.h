@@ -91,6 +91,15 @@ namespace PCGExPointsFilter
 			return TypedFilterFactory->Config.bInvertResult ? !Result : Result;
 		}
 
+		virtual bool IsConstant(bool& OutResult) const override
+		{
+			// Against an empty constant mask, only the strict comparison still depends on the flags
+			if (MaskReader || Bitmask != 0 || TypedFilterFactory->Config.Comparison == EPCGExBitflagComparison::MatchStrict) { return false; }
+			const bool Result = PCGExCompare::Compare(TypedFilterFactory->Config.Comparison, 0, 0);
+			OutResult = TypedFilterFactory->Config.bInvertResult ? !Result : Result;
+			return true;
+		}
+
 		virtual ~TBitmaskFilter() override
 		{
 			TypedFilterFactory = nullptr;
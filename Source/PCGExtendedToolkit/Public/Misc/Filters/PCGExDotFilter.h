@@ -103,6 +103,8 @@ namespace PCGExPointsFilter
 			return DotComparison.Test(Dot, DotComparison.GetDot(PointIndex));
 		}
 
+		virtual void TestScope(const int32 StartIndex, const int32 Count, uint64* OutBits) const override;
+
 		virtual ~TDotFilter() override
 		{
 			TypedFilterFactory = nullptr;
@@ -50,4 +50,12 @@ public:
 	/** Inverts the group output value. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, DisplayPriority=-1))
 	bool bInvert = false;
+
+	/** If enabled, sample a subset of points on init and reorder filters so the cheapest, most decisive ones run first. Chosen order is logged (verbose). */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, DisplayPriority=-1))
+	bool bReorderBySelectivity = false;
+
+	/** Number of points sampled to measure filters cost & pass rate. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, DisplayPriority=-1, EditCondition="bReorderBySelectivity", ClampMin=1))
+	int32 SelectivitySampleSize = 256;
 };
@@ -100,6 +100,16 @@ namespace PCGExPointsFilter
 			return PCGExCompare::Compare(TypedFilterFactory->Config.Comparison, FMath::Fmod(A, B), C, TypedFilterFactory->Config.Tolerance);
 		}
 
+		virtual void TestScope(const int32 StartIndex, const int32 Count, uint64* OutBits) const override;
+
+		virtual bool IsConstant(bool& OutResult) const override
+		{
+			// Fmod by (nearly) zero returns zero, leaving a comparison between two constants
+			if (OperandB || OperandC || !FMath::IsNearlyZero(TypedFilterFactory->Config.OperandBConstant, UE_SMALL_NUMBER)) { return false; }
+			OutResult = PCGExCompare::Compare(TypedFilterFactory->Config.Comparison, 0.0, TypedFilterFactory->Config.OperandCConstant, TypedFilterFactory->Config.Tolerance);
+			return true;
+		}
+
 		virtual ~TModuloComparisonFilter() override
 		{
 			TypedFilterFactory = nullptr;
@@ -84,6 +84,16 @@ namespace PCGExPointsFilter
 			return FMath::IsWithinInclusive(OperandA->Values[PointIndex], RealMin, RealMax) ? !bInvert : bInvert;
 		}
 
+		virtual void TestScope(const int32 StartIndex, const int32 Count, uint64* OutBits) const override;
+
+		virtual bool IsConstant(bool& OutResult) const override
+		{
+			// An exclusive range collapsed to a single value contains nothing
+			if (bInclusive || RealMin < RealMax) { return false; }
+			OutResult = bInvert;
+			return true;
+		}
+
 		virtual ~TWithinRangeFilter() override
 		{
 			TypedFilterFactory = nullptr;
@@ -48,6 +48,10 @@ public:
 	/** */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, ClampMin=0.01))
 	double Tolerance = 0.01;
+
+	/** Order in which points are processed. Doesn't change results. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Performance", meta=(PCG_NotOverridable), AdvancedDisplay)
+	EPCGExSpatialOrder ProcessingOrder = EPCGExSpatialOrder::None;
 };
 
 struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExCollocationCountContext final : public FPCGExPointsProcessorContext
@@ -13,41 +13,37 @@ namespace PCGExPartition
 {
 	PCGEX_ASYNC_STATE(State_DistributeToPartition)
 
-	class FKPartition;
-
-	class /*PCGEXTENDEDTOOLKIT_API*/ FKPartition
+	/**
+	 * Fold a rule value into a running partition key.
+	 * Bijective for a single rule; combining several rules may theoretically collide.
+	 */
+	FORCEINLINE uint64 CombineKey(const uint64 Key, const int64 Value)
 	{
-	protected:
-		mutable FRWLock LayersLock;
-		mutable FRWLock PointLock;
-
-	public:
-		FKPartition(FKPartition* InParent, int64 InKey, FPCGExFilter::FRule* InRule, int32 InPartitionIndex);
-		~FKPartition();
+		uint64 X = Key ^ (static_cast<uint64>(Value) + 0x9E3779B97F4A7C15ull + (Key << 6) + (Key >> 2));
+		X = (X ^ (X >> 30)) * 0xBF58476D1CE4E5B9ull;
+		X = (X ^ (X >> 27)) * 0x94D049BB133111EBull;
+		return X ^ (X >> 31);
+	}
 
-		FKPartition* Parent = nullptr;
+	struct /*PCGEXTENDEDTOOLKIT_API*/ FPartition
+	{
+		uint64 Key = 0;
+		int32 FirstPoint = -1; // Lowest point index, also used to read back rule values
+		int32 Start = 0;       // Offset in the scattered point indices
+		int32 Count = 0;
 		int32 IOIndex = -1;
-		int32 PartitionIndex = 0;
-		int64 PartitionKey = 0;
-		FPCGExFilter::FRule* Rule = nullptr;
-
-		TSet<int64> UniquePartitionKeys;
-		TMap<int64, FKPartition*> SubLayers;
-		TArray<int32> Points;
-
-		int32 GetNum() const { return Points.Num(); }
-		int32 GetSubPartitionsNum();
-
-		FKPartition* GetPartition(int64 Key, FPCGExFilter::FRule* InRule);
-		FORCEINLINE void Add(const int64 Index)
-		{
-			FWriteScopeLock WriteLock(PointLock);
-			Points.Add(Index);
-		}
-
-		void Register(TArray<FKPartition*>& Partitions);
+	};
 
-		void SortPartitions();
+	// Per-chunk key histogram, in first-occurrence order. Chunks are sized so there is roughly one per worker.
+	struct /*PCGEXTENDEDTOOLKIT_API*/ FChunkHistogram
+	{
+		int32 Start = 0;
+		int32 Count = 0;
+		TMap<uint64, int32> LocalIndices;
+		TArray<uint64> Keys;
+		TArray<int32> Counts;
+		TArray<int32> PartitionIndices; // Global partition of each local key
+		TArray<int32> Cursors;
 	};
 }
 
@@ -151,11 +147,18 @@ namespace PCGExPartitionByValues
 		TArray<FPCGExFilter::FRule> Rules;
 		TArray<int64> KeySums;
 
-		PCGExPartition::FKPartition* RootPartition = nullptr;
+		TArray<uint64> PointKeys;
+		TArray<int32> PointLocalIndices;
+		TArray<PCGExPartition::FChunkHistogram> Histograms;
 
 		int32 NumPartitions = -1;
-		TArray<PCGExPartition::FKPartition*> Partitions;
+		TArray<PCGExPartition::FPartition> Partitions;
+		TArray<int32> PartitionedPoints;
+		TArray<int32> PartitionRanks; // NumPartitions * NumRules, rank of each rule value among its siblings
+
+		bool bKeyCollision = false;
 
+		const UPCGExPartitionByValuesBaseSettings* LocalSettings = nullptr;
 		FPCGExPartitionByValuesBaseContext* LocalTypedContext = nullptr;
 
 	public:
@@ -168,8 +171,15 @@ namespace PCGExPartitionByValues
 
 		virtual bool Process(PCGExMT::FTaskManager* AsyncManager) override;
 		virtual void PrepareSingleLoopScopeForPoints(const uint32 StartIndex, const int32 Count) override;
-		virtual void ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const int32 LoopIdx, const int32 Count) override;
+		virtual void ProcessSingleInPoint(const int32 Index, const FPCGPoint& Point, const int32 LoopIdx, const int32 Count) override;
 		virtual void ProcessSingleRangeIteration(const int32 Iteration, const int32 LoopIdx, const int32 LoopCount) override;
 		virtual void CompleteWork() override;
+
+	protected:
+		void CountKeys(const int32 StartIndex, const int32 Count, const int32 LoopIdx);
+		void BuildPartitions();
+		void ScatterPoints(const int32 HistogramIndex);
+		void ResolveKeyCollisions();
+		void ComputePartitionRanks();
 	};
 }
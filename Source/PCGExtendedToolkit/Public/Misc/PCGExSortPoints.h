@@ -123,8 +123,31 @@ protected:
 
 namespace PCGExSortPoints
 {
+	// Map a double to a uint64 that sorts the same way
+	FORCEINLINE uint64 GetRadixKey(const double Value)
+	{
+		uint64 Bits;
+		FMemory::Memcpy(&Bits, &Value, sizeof(uint64));
+		return (Bits & 0x8000000000000000ull) ? ~Bits : Bits | 0x8000000000000000ull;
+	}
+
+	/**
+	 * Stable LSD radix sort of Order, using Keys[Order[i]] as sort key.
+	 * Digits that are uniform across all keys are skipped.
+	 */
+	void RadixSort(TArray<int32>& Order, const TArray<uint64>& Keys);
+
 	class FProcessor final : public PCGExPointsMT::FPointsProcessor
 	{
+		const UPCGExSortPointsBaseSettings* LocalSettings = nullptr;
+
+		TArray<FPCGExSortRule*> Rules;
+		TArray<int32> Order;
+		TArray<int32> MergeBuffer;
+		int32 SortChunkSize = 0;
+		int32 MergeWidth = 0;
+		TArray<FPCGPoint> SortedPoints;
+
 	public:
 		explicit FProcessor(PCGExData::FPointIO* InPoints):
 			FPointsProcessor(InPoints)
@@ -133,9 +156,16 @@ namespace PCGExSortPoints
 
 		virtual ~FProcessor() override
 		{
+			PCGEX_DELETE_TARRAY(Rules)
 		}
 
 		virtual bool Process(PCGExMT::FTaskManager* AsyncManager) override;
 		virtual void CompleteWork() override;
+
+	protected:
+		bool Compare(const int32 A, const int32 B) const;
+		void StartMergePass();
+		void MergeBlock(const int32 OutStart, const int32 OutEnd);
+		void StartGather();
 	};
 }
@@ -54,6 +54,18 @@ enum class EPCGExSingleField : uint8
 	Length = 4 UMETA(DisplayName = "Length", ToolTip="Length if vector, raw value otherwise."),
 };
 
+/**
+ * Point processing order. Following a space-filling curve makes consecutive queries hit the same parts
+ * of the target structures, which pays off on large, unordered point sets.
+ */
+UENUM(BlueprintType, meta=(DisplayName="[PCGEx] Spatial Order"))
+enum class EPCGExSpatialOrder : uint8
+{
+	None    = 0 UMETA(DisplayName = "None", ToolTip="Process points in their input order."),
+	Morton  = 1 UMETA(DisplayName = "Morton (Z-Order)", ToolTip="Process points along a Z-order curve. Cheap to compute, good locality."),
+	Hilbert = 2 UMETA(DisplayName = "Hilbert", ToolTip="Process points along a Hilbert curve. Slightly more expensive to compute, best locality."),
+};
+
 UENUM(BlueprintType, meta=(DisplayName="[PCGEx] Axis Selector"))
 enum class EPCGExAxis : uint8
 {
@@ -289,8 +301,173 @@ namespace PCGEx
 
 	FORCEINLINE static uint32 GH(const FVector& Seed, const FInt64Vector3& Tolerance) { return GetTypeHash(I643(Seed, Tolerance)); }
 
+	/** 64-bit mix of full voxel coordinates; high bits are well distributed and safe to use for sharding. */
+	FORCEINLINE static uint64 GH64(const FInt64Vector3& Seed)
+	{
+		uint64 H = static_cast<uint64>(Seed.X) * 0x9E3779B97F4A7C15ull;
+		H = (H ^ (H >> 32) ^ static_cast<uint64>(Seed.Y)) * 0xC2B2AE3D27D4EB4Full;
+		H = (H ^ (H >> 29) ^ static_cast<uint64>(Seed.Z)) * 0x165667B19E3779F9ull;
+		return H ^ (H >> 32);
+	}
+
 	FORCEINLINE static uint32 GH(const FVector& Seed, const FVector& Tolerance) { return GetTypeHash(I643(Seed, Tolerance)); }
 
+#pragma region Index Lookup
+
+	/**
+	 * Integer key -> index lookup, meant to replace TMap<Key, int32> in inner loops.
+	 * Keys living in a bounded window are stored in a flat array (-1 = missing), sparse key sets fall back to a TMap.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FIndexLookup
+	{
+	protected:
+		int64 Offset = 0;
+		TArray<int32> Dense;
+		TMap<int64, int32> Sparse;
+		bool bSparse = false;
+
+	public:
+		static constexpr int32 MaxDenseRatio = 4; // Max key range / key count before falling back to sparse storage
+
+		FIndexLookup()
+		{
+		}
+
+		explicit FIndexLookup(const int32 InSize, const int64 InOffset = 0)
+		{
+			Init(InSize, InOffset);
+		}
+
+		/** Reset to an empty dense lookup covering keys [InOffset, InOffset + InSize[ */
+		void Init(const int32 InSize, const int64 InOffset = 0)
+		{
+			Empty();
+			Offset = InOffset;
+			Dense.Init(-1, InSize);
+		}
+
+		/** Map each Keys[i] to i */
+		template <typename T>
+		void InitFromKeys(const TArrayView<const T>& Keys)
+		{
+			Empty();
+			if (Keys.IsEmpty()) { return; }
+
+			int64 Min = MAX_int64;
+			int64 Max = MIN_int64;
+			for (const T Key : Keys)
+			{
+				Min = FMath::Min<int64>(Min, Key);
+				Max = FMath::Max<int64>(Max, Key);
+			}
+
+			if (Max - Min < static_cast<int64>(Keys.Num()) * MaxDenseRatio)
+			{
+				Init(static_cast<int32>(Max - Min + 1), Min);
+				for (int i = 0; i < Keys.Num(); ++i) { Dense[Keys[i] - Min] = i; }
+			}
+			else
+			{
+				bSparse = true;
+				Sparse.Reserve(Keys.Num());
+				for (int i = 0; i < Keys.Num(); ++i) { Sparse.Add(Keys[i], i); }
+			}
+		}
+
+		template <typename T>
+		void InitFromKeys(const TArray<T>& Keys) { InitFromKeys(TArrayView<const T>(Keys)); }
+
+		void Empty()
+		{
+			Offset = 0;
+			Dense.Empty();
+			Sparse.Empty();
+			bSparse = false;
+		}
+
+		/** Make room for keys [Offset, Offset + InNum[ */
+		void Reserve(const int32 InNum)
+		{
+			if (bSparse) { Sparse.Reserve(InNum); }
+			else if (Dense.Num() < InNum) { Grow(InNum); }
+		}
+
+		void Shrink()
+		{
+			Dense.Shrink();
+			Sparse.Shrink();
+		}
+
+		bool IsSparse() const { return bSparse; }
+
+		FORCEINLINE void Add(const int64 Key, const int32 Value)
+		{
+			if (!bSparse)
+			{
+				const int64 Index = Key - Offset;
+				if (Index >= 0 && Index < Dense.Num())
+				{
+					Dense[Index] = Value;
+					return;
+				}
+
+				if (Index >= 0 && Index < FMath::Max(Dense.Num() * 2, 1024))
+				{
+					Grow(Index + 1);
+					Dense[Index] = Value;
+					return;
+				}
+
+				ConvertToSparse();
+			}
+
+			Sparse.Add(Key, Value);
+		}
+
+		FORCEINLINE const int32* Find(const int64 Key) const
+		{
+			if (bSparse) { return Sparse.Find(Key); }
+			const int64 Index = Key - Offset;
+			if (Index < 0 || Index >= Dense.Num()) { return nullptr; }
+			const int32* Value = Dense.GetData() + Index;
+			return *Value == -1 ? nullptr : Value;
+		}
+
+		FORCEINLINE int32 operator[](const int64 Key) const { return bSparse ? Sparse.FindChecked(Key) : Dense[Key - Offset]; }
+
+		/** Offset every key by Delta */
+		void ShiftKeys(const int64 Delta)
+		{
+			if (!bSparse)
+			{
+				Offset += Delta;
+				return;
+			}
+
+			TMap<int64, int32> Shifted;
+			Shifted.Reserve(Sparse.Num());
+			for (const TPair<int64, int32>& Pair : Sparse) { Shifted.Add(Pair.Key + Delta, Pair.Value); }
+			Sparse = MoveTemp(Shifted);
+		}
+
+	protected:
+		void Grow(const int64 InNum)
+		{
+			const int32 StartIndex = Dense.Num();
+			Dense.SetNumUninitialized(InNum);
+			for (int i = StartIndex; i < InNum; ++i) { Dense[i] = -1; }
+		}
+
+		void ConvertToSparse()
+		{
+			bSparse = true;
+			for (int i = 0; i < Dense.Num(); ++i) { if (Dense[i] != -1) { Sparse.Add(i + Offset, Dense[i]); } }
+			Dense.Empty();
+		}
+	};
+
+#pragma endregion
+
 
 #pragma region Field Helpers
 
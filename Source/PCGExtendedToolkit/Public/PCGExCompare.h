@@ -466,6 +466,21 @@ namespace PCGExCompare
 		}
 	}
 
+	/** Branch-free scalar comparison resolved at compile time, for use in loops the compiler can vectorize. */
+	template <EPCGExComparison Method>
+	FORCEINLINE static bool CompareStatic(const double A, const double B, const double Tolerance)
+	{
+		if constexpr (Method == EPCGExComparison::StrictlyEqual) { return A == B; }
+		else if constexpr (Method == EPCGExComparison::StrictlyNotEqual) { return A != B; }
+		else if constexpr (Method == EPCGExComparison::EqualOrGreater) { return A >= B; }
+		else if constexpr (Method == EPCGExComparison::EqualOrSmaller) { return A <= B; }
+		else if constexpr (Method == EPCGExComparison::StrictlyGreater) { return A > B; }
+		else if constexpr (Method == EPCGExComparison::StrictlySmaller) { return A < B; }
+		else if constexpr (Method == EPCGExComparison::NearlyEqual) { return FMath::Abs(A - B) <= Tolerance; }
+		else if constexpr (Method == EPCGExComparison::NearlyNotEqual) { return FMath::Abs(A - B) > Tolerance; }
+		else { return false; }
+	}
+
 	FORCEINLINE static bool Compare(const EPCGExBitflagComparison Method, const int64& Flags, const int64& Mask)
 	{
 		switch (Method)
@@ -19,6 +19,13 @@ enum class EPCGExAsyncPriority : uint8
 	Default  = 6 UMETA(DisplayName = "Default", ToolTip="Position component."),
 };
 
+UENUM(BlueprintType, meta=(DisplayName="[PCGEx] Task Scheduler"))
+enum class EPCGExTaskScheduler : uint8
+{
+	PerTask      = 0 UMETA(DisplayName = "Per Task", ToolTip="Each range chunk is dispatched as its own async task."),
+	WorkStealing = 1 UMETA(DisplayName = "Work Stealing", ToolTip="Range chunks are spread over per-worker deques, split on demand and stolen by idle workers."),
+};
+
 UENUM(BlueprintType, meta=(DisplayName="[PCGEx] Data Blending Type (With Defaults)"))
 enum class EPCGExDataBlendingTypeDefault : uint8
 {
@@ -64,6 +71,18 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bDefaultBuildAndCacheClusters&&bCacheClusters"))
 	bool bDefaultCacheExpandedClusters = false;
 
+	/** Also persist built clusters under Saved/PCGEx/ClusterCache, keyed by their resolved topology, so identical graphs don't have to be rebuilt from attributes in later sessions. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bCacheClusters"))
+	bool bCacheClustersOnDisk = false;
+
+	/** Least recently used cluster files are deleted once the on-disk cache grows past that size. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bCacheClusters&&bCacheClustersOnDisk", ClampMin=1))
+	int32 ClusterDiskCacheMaxSizeMB = 1024;
+
+	/** Cluster files unused for that many days are deleted. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bCacheClusters&&bCacheClustersOnDisk", ClampMin=1))
+	int32 ClusterDiskCacheMaxAgeDays = 30;
+
 
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Points", meta=(ClampMin=1))
 	int32 SmallPointsSize = 256;
@@ -73,10 +92,34 @@ public:
 	int32 PointsDefaultBatchChunkSize = 256;
 	int32 GetPointsBatchChunkSize(const int32 In = -1) const { return In <= -1 ? PointsDefaultBatchChunkSize : In; }
 
+	/** Share spatial indices built over the same point data between nodes. Indices are kept until their data is garbage collected or the budget is exceeded. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Points")
+	bool bCacheSpatialIndices = false;
+
+	/** Memory budget of the shared spatial index cache, in megabytes. Least recently used indices are evicted first, once no node is using them anymore. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Points", meta=(EditCondition="bCacheSpatialIndices", ClampMin=1))
+	int32 SpatialIndexCacheBudget = 256;
+
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Async")
 	EPCGExAsyncPriority DefaultWorkPriority = EPCGExAsyncPriority::Normal;
 	EPCGExAsyncPriority GetDefaultWorkPriority() const { return DefaultWorkPriority == EPCGExAsyncPriority::Default ? EPCGExAsyncPriority::Normal : DefaultWorkPriority; }
 
+	/** Backend used to execute parallel range loops. Work Stealing dispatches one task per worker instead of one per chunk. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Async")
+	EPCGExTaskScheduler TaskScheduler = EPCGExTaskScheduler::PerTask;
+
+	/**
+	 * Let parallel point, node & edge loops resize their chunks based on measured per-item cost. Costs are remembered per node between executions.
+	 * With the Per Task scheduler, workers also grab more chunks at once as they get measured.
+	 * With Work Stealing, remembered costs only size the chunks stealing splits down to; stealing does the balancing.
+	 */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Async")
+	bool bAdaptiveChunkSize = false;
+
+	/** Target duration of a single dispatched task when adaptive chunk sizing is enabled, in microseconds. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Async", meta=(EditCondition="bAdaptiveChunkSize", ClampMin=10))
+	double AdaptiveChunkTargetDuration = 500;
+
 	UPROPERTY(EditAnywhere, config, Category = "Blending|Attribute Types Defaults|Simple Types", meta=(DisplayName="Boolean"))
 	EPCGExDataBlendingTypeDefault DefaultBooleanBlendMode = EPCGExDataBlendingTypeDefault::Default;
 
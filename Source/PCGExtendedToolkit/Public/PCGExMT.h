@@ -189,6 +189,225 @@ namespace PCGExMT
 	class FPCGExTask;
 	class FTaskGroup;
 	class FGroupRangeCallbackTask;
+	class FGroupRangeIterationTask;
+	class FGroupPrepareRangeTask;
+	class FWorkStealingTask;
+	class FGroupAdaptiveRangeTask;
+	class FTaskGraph;
+	class FTaskGraphNodeTask;
+
+#pragma region Stats
+
+	const FName OutputTaskStatsLabel = TEXT("Task Stats");
+
+	/**
+	 * Timing & throughput of task groups, aggregated by group name.
+	 * Times are in seconds.
+	 */
+	struct /*PCGEXTENDEDTOOLKIT_API*/ FTaskGroupStats
+	{
+		FName Name = NAME_None;
+		int32 NumGroups = 0;
+		double WallTime = 0;
+		double BusyTime = 0;
+		int64 NumChunks = 0;
+		int64 NumItems = 0;
+		double MaxChunkTime = 0;
+
+		double GetAverageChunkTime() const { return NumChunks > 0 ? BusyTime / static_cast<double>(NumChunks) : 0; }
+
+		void Append(const FTaskGroupStats& Other)
+		{
+			NumGroups += Other.NumGroups;
+			WallTime += Other.WallTime;
+			BusyTime += Other.BusyTime;
+			NumChunks += Other.NumChunks;
+			NumItems += Other.NumItems;
+			MaxChunkTime = FMath::Max(MaxChunkTime, Other.MaxChunkTime);
+		}
+	};
+
+#pragma endregion
+
+#pragma region Task graph
+
+	/**
+	 * A single stage of a FTaskGraph.
+	 * A stage is complete once its work has run *and* every async task started from within it, transitively, has completed.
+	 * This lets stages that kick off their own groups (i.e processors) be chained without explicit OnComplete callbacks.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FTaskGraphNode
+	{
+		friend class FTaskGraph;
+		friend class FTaskGraphNodeTask;
+
+	public:
+		using WorkCallback = std::function<void()>;
+
+		FTaskGraphNode(FTaskGraph* InGraph, const FName InName, const WorkCallback& InWork):
+			Name(InName), Graph(InGraph), Work(InWork)
+		{
+		}
+
+		FName Name = NAME_None;
+
+		void Hold();
+		void Release();
+
+		static FTaskGraphNode* GetCurrent();
+
+	protected:
+		FTaskGraph* Graph = nullptr;
+		WorkCallback Work;
+		TArray<FTaskGraphNode*> Dependents;
+		std::atomic<int32> PendingDependencies = 0;
+		std::atomic<int32> PendingWork = 0;
+	};
+
+	/**
+	 * Routes tasks started on the current thread to the given graph node for the lifetime of the scope.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FTaskGraphScope
+	{
+	public:
+		explicit FTaskGraphScope(FTaskGraphNode* InNode);
+		~FTaskGraphScope();
+
+	private:
+		FTaskGraphNode* PreviousNode = nullptr;
+	};
+
+	/**
+	 * Small dependency graph of stages. Stages are dispatched as soon as all the stages they depend on are complete,
+	 * so independent chains (i.e Process -> CompleteWork -> Write of different inputs) overlap instead of waiting on each other.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FTaskGraph
+	{
+		friend class FTaskManager;
+		friend class FTaskGraphNode;
+
+		FName GraphName = NAME_None;
+
+	public:
+		using CompletionCallback = std::function<void()>;
+
+		explicit FTaskGraph(FTaskManager* InManager, const FName InGraphName):
+			GraphName(InGraphName), Manager(InManager)
+		{
+		}
+
+		~FTaskGraph();
+
+		FTaskGraphNode* Add(const FName InName, const FTaskGraphNode::WorkCallback& InWork);
+		void AddDependency(FTaskGraphNode* InNode, FTaskGraphNode* InDependsOn);
+
+		void SetOnCompleteCallback(const CompletionCallback& Callback)
+		{
+			bHasOnCompleteCallback = true;
+			OnCompleteCallback = Callback;
+		}
+
+		void Start();
+
+		FORCEINLINE bool IsComplete() const { return NumPending.load() <= 0; }
+
+	protected:
+		FTaskManager* Manager = nullptr;
+		TArray<FTaskGraphNode*> Nodes;
+		std::atomic<int32> NumPending = 0;
+
+		bool bHasOnCompleteCallback = false;
+		CompletionCallback OnCompleteCallback;
+
+		void Schedule(FTaskGraphNode* InNode);
+		void OnNodeCompleted(FTaskGraphNode* InNode);
+	};
+
+#pragma endregion
+
+#pragma region Adaptive chunks
+
+	/**
+	 * Process-wide memory of the measured per-item cost of range loops, keyed by settings UID & CRC and group name.
+	 * Used to size chunks up-front on subsequent executions. Least recently recorded entries are dropped past MaxEntries.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FChunkCostCache
+	{
+	public:
+		static constexpr int32 MaxEntries = 1024;
+
+		static FChunkCostCache& Get();
+
+		bool GetCost(const uint32 Key, double& OutSecondsPerItem) const;
+		void Record(const uint32 Key, const double SecondsPerItem);
+
+	protected:
+		struct FCost
+		{
+			double SecondsPerItem = 0;
+			uint64 LastRecord = 0;
+		};
+
+		mutable FRWLock CacheLock;
+		TMap<uint32, FCost> Costs;
+		uint64 RecordCounter = 0;
+
+		void EvictOldest();
+	};
+
+#pragma endregion
+
+#pragma region Work stealing
+
+	/**
+	 * Chunk-range deque owned by a single worker.
+	 * The owner pushes & pops at the back, thieves steal from the front where the largest ranges sit.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FWorkStealingDeque
+	{
+	public:
+		void Reset(const int32 InBegin, const int32 InEnd);
+		void Push(const int32 InBegin, const int32 InEnd);
+		bool Pop(int32& OutBegin, int32& OutEnd);
+		bool Steal(int32& OutBegin, int32& OutEnd);
+
+	protected:
+		mutable FRWLock DequeLock;
+		TArray<uint64> Ranges;
+		int32 Head = 0;
+	};
+
+	/**
+	 * Shared state of a single StartRanges/PrepareRangesOnly call when using the work-stealing scheduler.
+	 * Chunk indices are what get distributed & split, so LoopIdx stays consistent with the prepared scopes.
+	 * Jobs are pooled by the manager and recycled once their last worker exits.
+	 */
+	class /*PCGEXTENDEDTOOLKIT_API*/ FWorkStealingJob
+	{
+		friend class FTaskManager;
+		friend class FWorkStealingTask;
+
+	public:
+		~FWorkStealingJob();
+
+		void Init(FTaskGroup* InGroup, const int32 InMaxItems, const int32 InChunkSize, const bool bInPrepareOnly, const int32 InNumWorkers);
+		bool Next(const int32 WorkerIndex, int32& OutChunkIndex);
+
+		FORCEINLINE int32 GetNumWorkers() const { return NumWorkers; }
+
+	protected:
+		FTaskGroup* Group = nullptr;
+		int32 MaxItems = 0;
+		int32 ChunkSize = 1;
+		int32 NumChunks = 0;
+		int32 NumWorkers = 0;
+		bool bPrepareOnly = false;
+
+		std::atomic<int32> NumActiveWorkers = 0;
+		TArray<FWorkStealingDeque*> Deques;
+	};
+
+#pragma endregion
 
 	class /*PCGEXTENDEDTOOLKIT_API*/ FTaskManager
 	{
@@ -206,7 +425,15 @@ namespace PCGExMT
 		int8 Stopped = 0;
 		int8 ForceSync = 0;
 
+		EPCGExTaskScheduler Scheduler = EPCGExTaskScheduler::PerTask;
+
+		bool bAdaptiveChunkSize = false;
+		double AdaptiveTargetSeconds = 0.0005;
+
+		bool bTrackStats = false;
+
 		FTaskGroup* CreateGroup(const FName& GroupName);
+		FTaskGraph* CreateGraph(const FName& GraphName);
 
 		FORCEINLINE bool IsAvailable() const { return Stopped || Flushing ? false : true; }
 
@@ -241,6 +468,9 @@ namespace PCGExMT
 			Task.Manager = this;
 			Task.TaskIndex = TaskIndex;
 
+			Task.GraphNode = FTaskGraphNode::GetCurrent();
+			if (Task.GraphNode) { Task.GraphNode->Hold(); }
+
 			AsyncTask->StartBackgroundTask(GThreadPool, WorkPriority);
 		}
 
@@ -273,12 +503,31 @@ namespace PCGExMT
 		template <typename T>
 		T* GetContext() { return static_cast<T*>(Context); }
 
+		FORCEINLINE bool UseWorkStealing() const { return !ForceSync && Scheduler == EPCGExTaskScheduler::WorkStealing; }
+
+		FWorkStealingJob* AcquireJob();
+		void ReleaseJob(FWorkStealingJob* InJob);
+
+		uint32 GetCostKey(const FName InGroupName) const;
+
+		void AppendStats(const FTaskGroupStats& InStats);
+		void GetStats(TArray<FTaskGroupStats>& OutStats) const;
+
 	protected:
 		int8 Flushing = 0;
 		int32 NumStarted = 0;
 		int32 NumCompleted = 0;
 		TArray<FAsyncTaskBase*> QueuedTasks;
 		TArray<FTaskGroup*> Groups;
+		TArray<FTaskGraph*> Graphs;
+
+		mutable FRWLock JobsLock;
+		TArray<FWorkStealingJob*> Jobs;
+		TArray<FWorkStealingJob*> FreeJobs;
+
+		// Not cleared on Reset, so stats outlive the groups they were gathered from
+		mutable FRWLock StatsLock;
+		TMap<FName, FTaskGroupStats> GroupStats;
 	};
 
 	class /*PCGEXTENDEDTOOLKIT_API*/ FTaskGroup
@@ -291,6 +540,8 @@ namespace PCGExMT
 		friend class FGroupRangeIterationTask;
 		friend class FGroupPrepareRangeInlineTask;
 		friend class FGroupRangeInlineIterationTask;
+		friend class FWorkStealingTask;
+		friend class FGroupAdaptiveRangeTask;
 
 		FName GroupName = NAME_None;
 
@@ -303,6 +554,7 @@ namespace PCGExMT
 		explicit FTaskGroup(FTaskManager* InManager, const FName InGroupName):
 			GroupName(InGroupName), Manager(InManager)
 		{
+			bMeasureChunks = Manager->bTrackStats;
 		}
 
 		~FTaskGroup()
@@ -332,9 +584,12 @@ namespace PCGExMT
 		{
 			if (!Manager->IsAvailable()) { return; }
 
+			MarkStarted();
+
 			FPlatformAtomics::InterlockedAdd(&NumStarted, 1);
 			FAsyncTask<T>* ATask = new FAsyncTask<T>(InPointsIO, args...);
 			ATask->GetTask().Group = this;
+			ATask->GetTask().NumGroupItems = 1;
 			if (Manager->ForceSync) { Manager->StartSynchronousTask<T>(ATask, TaskIndex); }
 			else { Manager->StartBackgroundTask<T>(ATask, TaskIndex); }
 		}
@@ -344,6 +599,8 @@ namespace PCGExMT
 		{
 			if (!Manager->IsAvailable()) { return; }
 
+			MarkStarted();
+
 			TArray<uint64> Loops;
 			FPlatformAtomics::InterlockedAdd(&NumStarted, SubRanges(Loops, MaxItems, ChunkSize));
 
@@ -356,11 +613,23 @@ namespace PCGExMT
 				ATask->GetTask().Group = this;
 				ATask->GetTask().Scope = H;
 
+				// Built-in range tasks are measured by the group itself
+				if constexpr (!std::is_same_v<T, FGroupRangeIterationTask> && !std::is_same_v<T, FGroupPrepareRangeTask>)
+				{
+					ATask->GetTask().NumGroupItems = PCGEx::H64B(H);
+				}
+
 				if (Manager->ForceSync) { Manager->StartSynchronousTask<T>(ATask, LoopIdx++); }
 				else { Manager->StartBackgroundTask<T>(ATask, LoopIdx++); }
 			}
 		}
 
+		/**
+		 * Opt this group into adaptive chunk sizing, if enabled in the global settings.
+		 * Must be called before starting ranges.
+		 */
+		void SetAdaptiveChunkSize(const bool bEnabled = true);
+
 		void StartRanges(const IterationCallback& Callback, const int32 MaxItems, const int32 ChunkSize, const bool bInlined = false, const bool bExecuteSmallSynchronously = true);
 
 		void PrepareRangesOnly(const int32 MaxItems, const int32 ChunkSize, const bool bInline = false);
@@ -385,6 +654,43 @@ namespace PCGExMT
 		void PrepareRangeIteration(const int32 StartIndex, const int32 Count, const int32 LoopIdx) const;
 		void DoRangeIteration(const int32 StartIndex, const int32 Count, const int32 LoopIdx) const;
 
+		void InternalStartStealingRanges(const int32 MaxItems, const int32 ChunkSize, const bool bPrepareOnly);
+
+#pragma region Measurements
+
+		bool bMeasureChunks = false;
+
+		std::atomic<uint64> WallStartCycles = 0;
+		mutable std::atomic<uint64> MeasuredCycles = 0;
+		mutable std::atomic<uint64> MaxChunkCycles = 0;
+		mutable std::atomic<int64> MeasuredItems = 0;
+		mutable std::atomic<int32> MeasuredChunks = 0;
+
+		void MarkStarted();
+		void RecordChunk(const uint64 Cycles, const int32 Count) const;
+		void CommitMeasurements();
+
+#pragma endregion
+
+#pragma region Adaptive chunks
+
+		bool bAdaptiveChunkSize = false;
+		uint32 CostKey = 0;
+
+		std::atomic<int32> AdaptiveCursor = 0;
+		int32 AdaptiveMaxItems = 0;
+		int32 AdaptiveChunkSize = 1;
+		int32 AdaptiveNumChunks = 0;
+		int32 AdaptiveNumWorkers = 1;
+		bool bAdaptivePrepareOnly = false;
+
+		int32 GetAdaptiveChunkSize(const int32 MaxItems, const int32 ChunkSize) const;
+		int32 GetAdaptiveGrab(const int32 Remaining) const;
+
+		void InternalStartAdaptiveRanges(const int32 MaxItems, const int32 ChunkSize, const bool bPrepareOnly);
+
+#pragma endregion
+
 		template <typename T>
 		void InternalStartInlineRange(const int32 Index, const int32 MaxItems, const int32 ChunkSize)
 		{
@@ -418,7 +724,9 @@ namespace PCGExMT
 
 		FTaskManager* Manager = nullptr;
 		FTaskGroup* Group = nullptr;
+		FTaskGraphNode* GraphNode = nullptr;
 		int32 TaskIndex = -1;
+		int32 NumGroupItems = 0; // >0 when the owning group should time this task as a chunk
 		//FAsyncTaskBase* TaskPtr = nullptr;
 		PCGExData::FPointIO* PointIO = nullptr;
 
@@ -439,8 +747,28 @@ namespace PCGExMT
 			if (bWorkDone) { return; }
 			PCGEX_ASYNC_CHECKPOINT_VOID
 			bWorkDone = true;
-			const bool bResult = ExecuteTask();
-			if (Group) { Group->OnTaskCompleted(); }
+
+			bool bResult = false;
+
+			{
+				FTaskGraphScope GraphScope(GraphNode);
+
+				if (Group && Group->bMeasureChunks && NumGroupItems > 0)
+				{
+					const uint64 StartCycles = FPlatformTime::Cycles64();
+					bResult = ExecuteTask();
+					Group->RecordChunk(FPlatformTime::Cycles64() - StartCycles, NumGroupItems);
+				}
+				else
+				{
+					bResult = ExecuteTask();
+				}
+
+				if (Group) { Group->OnTaskCompleted(); }
+			}
+
+			// Release before notifying the manager, so dependent stages are accounted for before this task completes
+			if (GraphNode) { GraphNode->Release(); }
 			Manager->OnAsyncTaskExecutionComplete(this, bResult);
 		}
 
@@ -528,6 +856,42 @@ namespace PCGExMT
 		virtual bool ExecuteTask() override;
 	};
 
+	class FWorkStealingTask : public FPCGExTask
+	{
+	public:
+		explicit FWorkStealingTask(PCGExData::FPointIO* InPointIO, FWorkStealingJob* InJob):
+			FPCGExTask(InPointIO), Job(InJob)
+		{
+		}
+
+		FWorkStealingJob* Job = nullptr;
+		virtual bool ExecuteTask() override;
+	};
+
+	class FGroupAdaptiveRangeTask : public FPCGExTask
+	{
+	public:
+		explicit FGroupAdaptiveRangeTask(PCGExData::FPointIO* InPointIO, FTaskGroup* InRangeGroup):
+			FPCGExTask(InPointIO), RangeGroup(InRangeGroup)
+		{
+		}
+
+		FTaskGroup* RangeGroup = nullptr;
+		virtual bool ExecuteTask() override;
+	};
+
+	class FTaskGraphNodeTask : public FPCGExTask
+	{
+	public:
+		explicit FTaskGraphNodeTask(PCGExData::FPointIO* InPointIO, FTaskGraphNode* InNode):
+			FPCGExTask(InPointIO), Node(InNode)
+		{
+		}
+
+		FTaskGraphNode* Node = nullptr;
+		virtual bool ExecuteTask() override;
+	};
+
 	template <typename T>
 	class /*PCGEXTENDEDTOOLKIT_API*/ FWriteTask final : public FPCGExTask
 	{
@@ -9,6 +9,7 @@
 #include "PCGExOperation.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExPointFilter.h"
+#include "Geometry/PCGExGeoSpatialIndex.h"
 #include "Graph/PCGExGraph.h"
 
 namespace PCGExPointsMT
@@ -54,6 +55,10 @@ namespace PCGExPointsMT
 		bool bInlineProcessPoints = false;
 		bool bInlineProcessRange = false;
 
+		// When set, points are processed along a space-filling curve instead of in index order
+		EPCGExSpatialOrder PointsProcessingOrder = EPCGExSpatialOrder::None;
+		TArray<int32> SpatialOrder;
+
 		PCGExData::ESource CurrentProcessingSource = PCGExData::ESource::Out;
 
 	public:
@@ -141,7 +146,27 @@ namespace PCGExPointsMT
 
 			const int32 PLI = GetDefault<UPCGExGlobalSettings>()->GetPointsBatchChunkSize(PerLoopIterations);
 
+			if (PointsProcessingOrder != EPCGExSpatialOrder::None)
+			{
+				PCGExGeo::ComputeSpatialOrder(PointIO->GetData(Source)->GetPoints(), PointsProcessingOrder, SpatialOrder);
+
+				// Scopes are prepared in index order first, since scoped reads & filters expect contiguous ranges.
+				// Processing then walks the curve and scatters results back to the original indices.
+				PCGEX_ASYNC_GROUP(AsyncManagerPtr, PrepareScopesForPoints)
+				PrepareScopesForPoints->SetOnCompleteCallback([&, NumPoints, PLI]() { StartPointsProcessingLoop(NumPoints, PLI); });
+				PrepareScopesForPoints->SetOnIterationRangeStartCallback(
+					[&](const int32 StartIndex, const int32 Count, const int32 LoopIdx) { PrepareSingleLoopScopeForPoints(StartIndex, Count); });
+				PrepareScopesForPoints->PrepareRangesOnly(NumPoints, PLI);
+				return;
+			}
+
+			StartPointsProcessingLoop(NumPoints, PLI);
+		}
+
+		void StartPointsProcessingLoop(const int32 NumPoints, const int32 PLI)
+		{
 			PCGEX_ASYNC_GROUP(AsyncManagerPtr, ParallelLoopForPoints)
+			ParallelLoopForPoints->SetAdaptiveChunkSize();
 			ParallelLoopForPoints->SetOnCompleteCallback([&]() { OnPointsProcessingComplete(); });
 			ParallelLoopForPoints->SetOnIterationRangePrepareCallback([&](const TArray<uint64>& Loops) { PrepareLoopScopesForPoints(Loops); });
 			ParallelLoopForPoints->SetOnIterationRangeStartCallback(
@@ -159,19 +184,42 @@ namespace PCGExPointsMT
 
 		virtual void ProcessPoints(const int32 StartIndex, const int32 Count, const int32 LoopIdx)
 		{
-			PrepareSingleLoopScopeForPoints(StartIndex, Count);
-			TArray<FPCGPoint>& Points = PointIO->GetMutableData(CurrentProcessingSource)->GetMutablePoints();
-			for (int i = 0; i < Count; ++i)
+			if (CurrentProcessingSource == PCGExData::ESource::In)
 			{
-				const int32 PtIndex = StartIndex + i;
-				ProcessSinglePoint(PtIndex, Points[PtIndex], LoopIdx, Count);
+				// Input points are shared, they're only ever handed out as const
+				const TArray<FPCGPoint>& InPoints = PointIO->GetIn()->GetPoints();
+				ForEachPointInLoop(StartIndex, Count, [&](const int32 PtIndex) { ProcessSingleInPoint(PtIndex, InPoints[PtIndex], LoopIdx, Count); });
+				return;
 			}
+
+			TArray<FPCGPoint>& Points = PointIO->GetOut()->GetMutablePoints();
+			ForEachPointInLoop(StartIndex, Count, [&](const int32 PtIndex) { ProcessSinglePoint(PtIndex, Points[PtIndex], LoopIdx, Count); });
 		}
 
+		template <typename FuncT>
+		FORCEINLINE void ForEachPointInLoop(const int32 StartIndex, const int32 Count, FuncT&& Func)
+		{
+			if (!SpatialOrder.IsEmpty())
+			{
+				const int32* Order = SpatialOrder.GetData() + StartIndex;
+				for (int i = 0; i < Count; ++i) { Func(Order[i]); }
+				return;
+			}
+
+			PrepareSingleLoopScopeForPoints(StartIndex, Count);
+			for (int i = 0; i < Count; ++i) { Func(StartIndex + i); }
+		}
+
+		/** Called for each output point, when looping with ESource::Out */
 		virtual void ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const int32 LoopIdx, const int32 LoopCount)
 		{
 		}
 
+		/** Called for each input point, when looping with ESource::In */
+		virtual void ProcessSingleInPoint(const int32 Index, const FPCGPoint& Point, const int32 LoopIdx, const int32 LoopCount)
+		{
+		}
+
 		virtual void OnPointsProcessingComplete()
 		{
 		}
@@ -193,6 +241,7 @@ namespace PCGExPointsMT
 			const int32 PLI = GetDefault<UPCGExGlobalSettings>()->GetClusterBatchChunkSize(PerLoopIterations);
 
 			PCGEX_ASYNC_GROUP(AsyncManagerPtr, ParallelLoopForRanges)
+			ParallelLoopForRanges->SetAdaptiveChunkSize();
 			ParallelLoopForRanges->SetOnCompleteCallback([&]() { OnRangeProcessingComplete(); });
 			ParallelLoopForRanges->SetOnIterationRangePrepareCallback([&](const TArray<uint64>& Loops) { PrepareLoopScopesForRanges(Loops); });
 			ParallelLoopForRanges->SetOnIterationRangeStartCallback(
@@ -251,8 +300,12 @@ namespace PCGExPointsMT
 		{
 			if (PrimaryFilters)
 			{
-				const int32 MaxIndex = StartIndex + Count;
-				for (int i = StartIndex; i < MaxIndex; ++i) { PointFilterCache[i] = PrimaryFilters->Test(i); }
+				TArray<uint64, TInlineAllocator<32>> ScopeBits;
+				PCGEX_SET_NUM_UNINITIALIZED(ScopeBits, PCGExPointFilter::GetNumWords(Count))
+				PrimaryFilters->TestScope(StartIndex, Count, ScopeBits.GetData());
+
+				bool* FilterResults = PointFilterCache.GetData() + StartIndex;
+				for (int i = 0; i < Count; ++i) { FilterResults[i] = PCGExPointFilter::GetBit(ScopeBits.GetData(), i); }
 			}
 		}
 
@@ -270,6 +323,12 @@ namespace PCGExPointsMT
 		bool bInlineCompletion = false;
 		bool bInlineWrite = false;
 		bool bRequiresWriteStep = false;
+
+		/**
+		 * Chain Process -> CompleteWork -> Write per processor through a task graph, instead of waiting on every processor at each step.
+		 * Only safe when processors don't depend on each other's results, or on context-level work done in-between steps.
+		 */
+		bool bPipelineProcessing = false;
 		TArray<PCGExData::FFacade*> ProcessorFacades;
 		TMap<PCGExData::FPointIO*, FPointsProcessor*>* SubProcessorMap = nullptr;
 
@@ -389,9 +448,40 @@ namespace PCGExPointsMT
 				if (NewProcessor->IsTrivial()) { TrivialProcessors.Add(NewProcessor); }
 			}
 
+			if (bPipelineProcessing)
+			{
+				StartPipeline();
+				return;
+			}
+
 			PCGEX_ASYNC_MT_LOOP_TPL(Process, bInlineProcessing, { Processor->bIsProcessorValid = Processor->Process(AsyncManagerPtr); })
 		}
 
+		void StartPipeline()
+		{
+			PCGExMT::FTaskGraph* Pipeline = AsyncManagerPtr->CreateGraph(FName("BatchPipeline"));
+
+			for (T* Processor : Processors)
+			{
+				PCGExMT::FTaskGraphNode* ProcessStage = Pipeline->Add(
+					FName("Process"), [&, Processor]() { Processor->bIsProcessorValid = Processor->Process(AsyncManagerPtr); });
+
+				PCGExMT::FTaskGraphNode* CompleteWorkStage = Pipeline->Add(
+					FName("CompleteWork"), [Processor]() { if (Processor->bIsProcessorValid) { Processor->CompleteWork(); } });
+
+				Pipeline->AddDependency(CompleteWorkStage, ProcessStage);
+
+				if (!bRequiresWriteStep) { continue; }
+
+				PCGExMT::FTaskGraphNode* WriteStage = Pipeline->Add(
+					FName("Write"), [Processor]() { if (Processor->bIsProcessorValid) { Processor->Write(); } });
+
+				Pipeline->AddDependency(WriteStage, CompleteWorkStage);
+			}
+
+			Pipeline->Start();
+		}
+
 		virtual bool PrepareSingle(T* PointsProcessor)
 		{
 			return true;
@@ -399,6 +489,7 @@ namespace PCGExPointsMT
 
 		virtual void CompleteWork() override
 		{
+			if (bPipelineProcessing) { return; }
 			CurrentState = PCGExMT::State_Completing;
 			PCGEX_ASYNC_MT_LOOP_VALID_PROCESSORS(CompleteWork, bInlineCompletion, { Processor->CompleteWork(); })
 			FPointsProcessorBatchBase::CompleteWork();
@@ -406,6 +497,7 @@ namespace PCGExPointsMT
 
 		virtual void Write() override
 		{
+			if (bPipelineProcessing) { return; }
 			CurrentState = PCGExMT::State_Writing;
 			PCGEX_ASYNC_MT_LOOP_VALID_PROCESSORS(Write, bInlineWrite, { Processor->Write(); })
 			FPointsProcessorBatchBase::Write();
@@ -136,6 +136,10 @@ public:
 	/** Whether scoped attribute read is enabled or not. Disabling this on small dataset may greatly improve performance. It's enabled by default for legacy reasons. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, AdvancedDisplay))
 	bool bScopedAttributeGet = true;
+
+	/** Measure every task group of this node (wall & busy time, chunks, items) and output the results as an attribute set. Also emits Unreal Insights counters. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, AdvancedDisplay))
+	bool bOutputTaskStats = false;
 	
 protected:
 	virtual int32 GetPreferredChunkSize() const { return PCGExMT::GAsyncLoop_M; }
@@ -147,8 +151,11 @@ struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExPointsProcessorContext : public FPCGExCo
 	friend class FPCGExPointsProcessorElement;
 
 	bool bScopedAttributeGet = false;
+	bool bOutputTaskStats = false;
 	virtual ~FPCGExPointsProcessorContext() override;
 
+	virtual void OnComplete() override;
+
 	UWorld* World = nullptr;
 
 	mutable FRWLock ContextLock;
@@ -261,7 +261,7 @@ namespace PCGExBevelPath
 		FORCEINLINE double Len(const int32 Index) const { return Lengths[Index]; }
 
 		virtual bool Process(PCGExMT::FTaskManager* AsyncManager) override;
-		virtual void ProcessSinglePoint(const int32 Index, FPCGPoint& Point, const int32 LoopIdx, const int32 LoopCount) override;
+		virtual void ProcessSingleInPoint(const int32 Index, const FPCGPoint& Point, const int32 LoopIdx, const int32 LoopCount) override;
 		virtual void ProcessSingleRangeIteration(const int32 Iteration, const int32 LoopIdx, const int32 LoopCount) override;
 		void WriteFlags(const int32 Index);
 		virtual void CompleteWork() override;
@@ -284,6 +284,10 @@ public:
 	/** If enabled, mark filtered out points as "failed". Otherwise, just skip the processing altogether. Only uncheck this if you want to ensure existing attribute values are preserved. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_NotOverridable), AdvancedDisplay)
 	bool bProcessFilteredOutAsFails = true;
+
+	/** Order in which points are processed. Doesn't change results. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Performance", meta=(PCG_NotOverridable), AdvancedDisplay)
+	EPCGExSpatialOrder ProcessingOrder = EPCGExSpatialOrder::None;
 };
 
 struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExSampleInsideBoundsContext final : public FPCGExPointsProcessorContext
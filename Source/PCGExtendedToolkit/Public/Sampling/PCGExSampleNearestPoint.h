@@ -10,6 +10,7 @@
 #include "PCGExSampling.h"
 #include "PCGExDetails.h"
 #include "Data/Blending/PCGExDataBlending.h"
+#include "Data/PCGExSpatialIndexCache.h"
 
 #include "PCGExSampleNearestPoint.generated.h"
 
@@ -130,6 +131,10 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Sampling", meta=(PCG_Overridable))
 	EPCGExSampleMethod SampleMethod = EPCGExSampleMethod::WithinRange;
 
+	/** Number of closest targets to sample. Closest targets are selected center-to-center, and must still be within range. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Sampling", meta=(PCG_Overridable, EditCondition="SampleMethod==EPCGExSampleMethod::KNearest", EditConditionHides, ClampMin=1))
+	int32 NumNearest = 8;
+
 	/** Minimum target range. Used as fallback if LocalRangeMin is enabled but missing. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Sampling", meta=(PCG_Overridable, ClampMin=0, EditConditionHides, HideEditConditionToggle))
 	double RangeMin = 0;
@@ -285,6 +290,10 @@ public:
 	/** If enabled, mark filtered out points as "failed". Otherwise, just skip the processing altogether. Only uncheck this if you want to ensure existing attribute values are preserved. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_NotOverridable), AdvancedDisplay)
 	bool bProcessFilteredOutAsFails = true;
+
+	/** Order in which points are processed. Doesn't change results. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Performance", meta=(PCG_NotOverridable), AdvancedDisplay)
+	EPCGExSpatialOrder ProcessingOrder = EPCGExSpatialOrder::None;
 };
 
 struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExSampleNearestPointContext final : public FPCGExPointsProcessorContext
@@ -295,9 +304,11 @@ struct /*PCGEXTENDEDTOOLKIT_API*/ FPCGExSampleNearestPointContext final : public
 
 	PCGExData::FFacade* TargetsFacade = nullptr;
 	const UPCGPointData::PointOctree* TargetOctree = nullptr;
+	const PCGExGeo::FKDTree* TargetKDTree = nullptr; // Only acquired for KNearest sampling
 
 	FPCGExBlendingDetails BlendingDetails;
 	const TArray<FPCGPoint>* TargetPoints = nullptr;
+	const TArray<FVector>* TargetPositions = nullptr;
 	int32 NumTargets = 0;
 
 	TObjectPtr<UCurveFloat> WeightCurve = nullptr;
@@ -323,6 +334,7 @@ namespace PCGExSampleNearestPoints
 	class FProcessor final : public PCGExPointsMT::FPointsProcessor
 	{
 		bool bSingleSample = false;
+		bool bCenterToCenter = false;
 
 		FPCGExSampleNearestPointContext* LocalTypedContext = nullptr;
 		const UPCGExSampleNearestPointSettings* LocalSettings = nullptr;
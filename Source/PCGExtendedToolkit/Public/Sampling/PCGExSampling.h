@@ -36,6 +36,7 @@ enum class EPCGExSampleMethod : uint8
 	WithinRange    = 0 UMETA(DisplayName = "All (Within range)", ToolTip="Use RangeMax = 0 to include all targets"),
 	ClosestTarget  = 1 UMETA(DisplayName = "Closest Target", ToolTip="Picks & process the closest target only"),
 	FarthestTarget = 2 UMETA(DisplayName = "Farthest Target", ToolTip="Picks & process the farthest target only"),
+	KNearest       = 3 UMETA(DisplayName = "K Nearest Targets", ToolTip="Picks & process the K closest targets only. Samplers that don't support it process all targets within range instead."),
 };
 
 UENUM(BlueprintType, meta=(DisplayName="[PCGEx] Sample Source"))